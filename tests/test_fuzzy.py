@@ -0,0 +1,83 @@
+from __future__ import annotations
+
+from tp.python import fuzzy
+
+
+def test_fuzzy_score_requires_subsequence():
+    assert fuzzy.fuzzy_score('abc', 'aXbXc') is not None
+    assert fuzzy.fuzzy_score('abc', 'acb') is None
+    assert fuzzy.fuzzy_score('', 'anything') == 0
+
+
+def test_fuzzy_score_ranks_boundaries_and_consecutive_matches_higher():
+    # consecutive match scores higher than a scattered one.
+    assert fuzzy.fuzzy_score('rig', 'rigging') > fuzzy.fuzzy_score('rig', 'rotating')
+    # word boundary and camel case humps score higher than matches in the middle of words.
+    assert fuzzy.fuzzy_score('sc', 'Scene Cleaner') > fuzzy.fuzzy_score('sc', 'discard')
+    assert fuzzy.fuzzy_score('rn', 'renameNodes') > fuzzy.fuzzy_score('rn', 'return')
+
+
+def test_search_ranks_results_from_best_to_worst():
+    index = fuzzy.FuzzyIndex()
+    index.add('rename', ['Rename Nodes'])
+    index.add('return', ['Return Value'])
+    index.add('render', ['Render Settings'])
+
+    results = index.search('ren')
+    keys = [key for key, _ in results]
+    scores = [score for _, score in results]
+    assert set(keys) == {'rename', 'render', 'return'}
+    assert keys[-1] == 'return'
+    assert scores == sorted(scores, reverse=True)
+    assert [key for key, _ in index.search('ren', limit=1)] == keys[:1]
+
+
+def test_search_match_all_tokens():
+    index = fuzzy.FuzzyIndex()
+    index.add('a', ['create joint chain'])
+    index.add('b', ['create locator'])
+
+    assert [key for key, _ in index.search('create joint')] == ['a']
+    assert {key for key, _ in index.search('joint locator', match_all=False)} == {'a', 'b'}
+
+
+def test_index_updates():
+    index = fuzzy.FuzzyIndex()
+    index.add('action', ['Export Mesh'])
+    assert 'action' in index
+    assert [key for key, _ in index.search('export')] == ['action']
+
+    # updating a key replaces its texts, so old texts no longer match.
+    index.update('action', ['Import Mesh'])
+    assert len(index) == 1
+    assert index.texts('action') == ('Import Mesh',)
+    assert index.search('export') == []
+    assert [key for key, _ in index.search('import')] == ['action']
+
+    index.remove('action')
+    assert 'action' not in index
+    assert index.search('import') == []
+    assert index.candidates('import') == (set(), set())
+
+    index.add('other', ['Import Mesh'])
+    index.clear()
+    assert len(index) == 0
+    assert index.search('mesh') == []
+
+
+def test_search_job_steps_and_cancel():
+    index = fuzzy.FuzzyIndex()
+    for i in range(1000):
+        index.add(i, [f'node_{i}'])
+
+    job = fuzzy.FuzzySearchJob(index, 'node_99')
+    steps = 1
+    while not job.step(budget=0.0, chunk_size=64):
+        steps += 1
+    assert steps > 1
+    assert job.is_done()
+    assert job.results(limit=1)[0][0] == 99
+
+    cancelled_job = fuzzy.FuzzySearchJob(index, 'node')
+    cancelled_job.cancel()
+    assert cancelled_job.cancelled
@@ -0,0 +1,507 @@
+"""
+Headless benchmark suite that measures the cost of the most common tp-dcc operations: widget construction, tool
+lifecycle, properties saving, icon colorization, plugin discovery and DCC callbacks dispatch.
+
+Results are written as JSON, so they can be compared across versions.
+
+Usage (from the repository root folder):
+    python -m tp.core.benchmark --output benchmark.json
+    python -m tp.core.benchmark --sections plugins callbacks --plugin-files 10 100 1000 10000
+"""
+
+from __future__ import annotations
+
+import os
+import sys
+import json
+import time
+import shutil
+import inspect
+import logging
+import argparse
+import platform
+import tempfile
+import statistics
+from typing import Any, Callable
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+REPORT_VERSION = 1
+DEFAULT_REPEAT = 5
+DEFAULT_COUNT = 50
+DEFAULT_PROPERTY_COUNTS = (10, 100, 500)
+DEFAULT_PLUGIN_FILES = (10, 100, 1000, 10000)
+DEFAULT_ICON_COUNT = 500
+DEFAULT_CALLBACK_COUNTS = (1, 10, 100)
+DEFAULT_DISPATCH_COUNT = 10000
+SECTIONS = ('factory', 'tool', 'icons', 'plugins', 'callbacks')
+QT_SECTIONS = ('factory', 'tool', 'icons')
+
+
+def measure(func: Callable[[], Any], repeat: int = DEFAULT_REPEAT, setup: Callable[[], Any] | None = None) -> dict:
+    """
+    Measures the time it takes to call given function.
+
+    :param func: function to measure.
+    :param repeat: number of times the function is called.
+    :param setup: optional function called before each call. Its time is not measured.
+    :return: dictionary with the median, minimum and maximum times, in milliseconds.
+    """
+
+    times: list[float] = []
+    for _ in range(repeat):
+        if setup is not None:
+            setup()
+        start = time.perf_counter()
+        func()
+        times.append((time.perf_counter() - start) * 1000.0)
+
+    return {'median_ms': statistics.median(times), 'min_ms': min(times), 'max_ms': max(times)}
+
+
+def benchmark_factory(count: int = DEFAULT_COUNT, repeat: int = DEFAULT_REPEAT) -> dict:
+    """
+    Measures the construction cost of the widgets created by each one of the tp.qt.factory helpers.
+
+    :param count: number of widgets created per measurement.
+    :param repeat: number of times each measurement is repeated.
+    :return: dictionary with the helper names as keys and the time per widget as values. "ui_plan" key stores the
+        UI spec build times (see `_benchmark_ui_plan`).
+    """
+
+    from ..externals.Qt.QtWidgets import QApplication, QWidget
+    from ..externals.Qt.QtGui import QIcon
+    from ..qt import factory
+
+    # helpers whose arguments have no default value.
+    overrides: dict[str, Callable[[], Any]] = {'icon_label': lambda: factory.icon_label(QIcon(), text='Label')}
+
+    report: dict[str, Any] = {}
+    for name, func in inspect.getmembers(factory, inspect.isfunction):
+        if name.startswith('_') or func.__module__ != factory.__name__:
+            continue
+        create = overrides.get(name)
+        if create is None:
+            parameters = inspect.signature(func).parameters.values()
+            if any(param.default is inspect.Parameter.empty and param.kind in (
+                    param.POSITIONAL_ONLY, param.POSITIONAL_OR_KEYWORD, param.KEYWORD_ONLY) for param in parameters):
+                continue
+            create = func
+
+        created: list = []
+
+        def _create():
+            for _ in range(count):
+                created.append(create())
+
+        def _clear():
+            for obj in created:
+                if isinstance(obj, QWidget):
+                    obj.deleteLater()
+            created.clear()
+            QApplication.processEvents()
+
+        try:
+            result = measure(_create, repeat=repeat, setup=_clear)
+        except Exception as exc:
+            logger.warning(f'Was not possible to benchmark factory helper "{name}": {exc}')
+            report[name] = {'error': str(exc)}
+            continue
+        finally:
+            _clear()
+        report[name] = {key: value / count for key, value in result.items()}
+    report['ui_plan'] = _benchmark_ui_plan(count=count, repeat=repeat)
+
+    return report
+
+
+def _benchmark_ui_plan(count: int = DEFAULT_COUNT, repeat: int = DEFAULT_REPEAT) -> dict:
+    """
+    Internal function that measures the construction cost of a UI built from a spec: compiling the spec on each build,
+    building it from a plan compiled once (sizes and dynamic properties resolved at compile time) and building the
+    same UI by calling the factory helpers directly.
+
+    :param count: number of rows of the built UI.
+    :param repeat: number of times each measurement is repeated.
+    :return: dictionary with the build modes as keys and the time per build as values.
+    """
+
+    from ..externals.Qt.QtWidgets import QApplication, QWidget
+    from ..qt import factory, dpi
+
+    spec = {'type': 'vertical_layout', 'children': [
+        {'type': 'horizontal_layout', 'children': [
+            {'type': 'label', 'kwargs': {'text': f'Row {i}'}, 'sizes': {'min_width': 80},
+             'properties': {'heading': 'h3'}},
+            {'type': 'line_edit', 'name': f'row_{i}', 'prop': f'row_{i}', 'sizes': {'fixed_height': 20},
+             'properties': {'frameless': True}}]} for i in range(count)]}
+    plan = factory.compile_ui_spec(spec)
+    parents: list[QWidget] = []
+
+    def _parent() -> QWidget:
+        parent = QWidget()
+        parents.append(parent)
+        return parent
+
+    def _compile_and_build():
+        factory.compile_ui_spec(spec).build(parent=_parent())
+
+    def _build():
+        plan.build(parent=_parent())
+
+    def _direct():
+        parent = _parent()
+        layout = factory.vertical_layout()
+        for i in range(count):
+            row_layout = factory.horizontal_layout()
+            row_label = factory.label(text=f'Row {i}')
+            row_label.setMinimumWidth(dpi.dpi_scale(80))
+            row_label.setProperty('heading', 'h3')
+            row_line_edit = factory.line_edit()
+            row_line_edit.setFixedHeight(dpi.dpi_scale(20))
+            row_line_edit.setProperty('frameless', True)
+            row_line_edit.setProperty('prop', f'row_{i}')
+            row_layout.addWidget(row_label)
+            row_layout.addWidget(row_line_edit)
+            layout.addLayout(row_layout)
+        parent.setLayout(layout)
+
+    def _clear():
+        for parent in parents:
+            parent.deleteLater()
+        parents.clear()
+        QApplication.processEvents()
+
+    report: dict[str, Any] = {'rows': count}
+    for name, func in (('compile_and_build', _compile_and_build), ('build', _build), ('direct', _direct)):
+        try:
+            report[name] = measure(func, repeat=repeat, setup=_clear)
+        finally:
+            _clear()
+
+    return report
+
+
+def _benchmark_tool_class(property_count: int) -> type:
+    """
+    Internal function that returns a tool class whose UI contains the given number of linked properties.
+
+    :param property_count: number of properties.
+    :return: tool class.
+    """
+
+    from ..externals.Qt.QtWidgets import QWidget, QVBoxLayout
+    from ..python import decorators
+    from ..qt.widgets import lineedits
+    from . import tool
+
+    class BenchmarkTool(tool.Tool):
+
+        # noinspection PyMethodParameters
+        @decorators.classproperty
+        def id(cls) -> str:
+            return 'tp.benchmark'
+
+        # noinspection PyMethodParameters
+        @decorators.classproperty
+        def ui_data(cls) -> tool.UiData:
+            return tool.UiData(label='Benchmark', auto_link_properties=True)
+
+        def contents(self) -> list[QWidget]:
+            widget = QWidget()
+            layout = QVBoxLayout(widget)
+            for i in range(property_count):
+                line_edit = lineedits.BaseLineEdit(text=str(i), parent=widget)
+                setattr(widget, f'property_{i}', line_edit)
+                layout.addWidget(line_edit)
+            return [widget]
+
+    return BenchmarkTool
+
+
+def benchmark_tool(property_counts: tuple[int, ...] = DEFAULT_PROPERTY_COUNTS, repeat: int = DEFAULT_REPEAT) -> dict:
+    """
+    Measures tool open and close time and properties saving latency with the given number of properties.
+
+    :param property_counts: number of tool properties to measure with.
+    :param repeat: number of times each measurement is repeated.
+    :return: dictionary with the property counts as keys and the measurements as values.
+    """
+
+    from ..externals.Qt.QtWidgets import QApplication
+
+    report: dict[str, Any] = {}
+    for property_count in sorted({count for count in property_counts if count > 0}):
+        tool_class = _benchmark_tool_class(property_count)
+        open_times: list[float] = []
+        close_times: list[float] = []
+        save_times: list[float] = []
+        for _ in range(repeat):
+            tool_instance = tool_class()
+            start = time.perf_counter()
+            window = tool_instance.execute()
+            QApplication.processEvents()
+            open_times.append((time.perf_counter() - start) * 1000.0)
+
+            # properties saving latency after a single edit.
+            widgets = tool_instance.property_widgets()
+            if widgets:
+                widgets[len(widgets) // 2].setText('edited')
+                start = time.perf_counter()
+                tool_instance.save_properties()
+                save_times.append((time.perf_counter() - start) * 1000.0)
+
+            start = time.perf_counter()
+            window.close()
+            tool_instance._run_teardown()
+            window.deleteLater()
+            QApplication.processEvents()
+            close_times.append((time.perf_counter() - start) * 1000.0)
+
+        report[str(property_count)] = {
+            'open_ms': statistics.median(open_times),
+            'close_ms': statistics.median(close_times),
+            'save_properties_ms': statistics.median(save_times) if save_times else None
+        }
+
+    return report
+
+
+def benchmark_icons(count: int = DEFAULT_ICON_COUNT, size: int = 32, repeat: int = DEFAULT_REPEAT) -> dict:
+    """
+    Measures icon colorization throughput.
+
+    :param count: number of pixmaps colorized per measurement.
+    :param size: pixmaps size in pixels.
+    :param repeat: number of times each measurement is repeated.
+    :return: dictionary with the colorized pixmaps per second of each colorization function.
+    """
+
+    from ..externals.Qt.QtCore import Qt
+    from ..externals.Qt.QtGui import QPixmap, QIcon, QColor
+    from ..qt import pixmap, icon
+
+    source = QPixmap(size, size)
+    source.fill(Qt.transparent)
+    pixmaps = [QPixmap(source) for _ in range(count)]
+    source_icon = QIcon(source)
+    color = QColor(255, 128, 0)
+
+    def _colorize_pixmap():
+        for p in pixmaps:
+            pixmap.colorize_pixmap(p, color)
+
+    def _colorize_pixmaps():
+        pixmap.colorize_pixmaps(pixmaps, color)
+
+    def _colorize_icon():
+        for _ in range(count):
+            icon.colorize_icon(source_icon, size=size, color=color)
+
+    report: dict[str, Any] = {'count': count, 'size': size}
+    for name, func in (
+            ('colorize_pixmap', _colorize_pixmap), ('colorize_pixmaps', _colorize_pixmaps),
+            ('colorize_icon', _colorize_icon)):
+        result = measure(func, repeat=repeat)
+        report[name] = dict(result, per_second=count / (result['median_ms'] / 1000.0) if result['median_ms'] else None)
+
+    return report
+
+
+def create_plugin_tree(root: str, file_count: int, files_per_folder: int = 100, plugin_ratio: float = 0.1):
+    """
+    Creates a synthetic plugin folder tree.
+
+    :param root: folder where tree is created.
+    :param file_count: number of Python files to create.
+    :param files_per_folder: number of files per folder.
+    :param plugin_ratio: ratio of files that define a plugin class.
+    :return: number of files defining a plugin class.
+    """
+
+    plugin_every = max(1, int(round(1.0 / plugin_ratio))) if plugin_ratio > 0 else 0
+    plugin_count = 0
+    for i in range(file_count):
+        folder_path = os.path.join(root, f'package_{i // files_per_folder:04d}')
+        if i % files_per_folder == 0:
+            os.makedirs(folder_path, exist_ok=True)
+        with open(os.path.join(folder_path, f'module_{i:05d}.py'), 'w') as f:
+            if plugin_every and i % plugin_every == 0:
+                plugin_count += 1
+                f.write(
+                    'from tp.python import plugin\n\n\n'
+                    f'class BenchmarkPlugin{i}(plugin.Plugin):\n'
+                    f'    ID = "benchmark.plugin.{i}"\n')
+            else:
+                f.write(f'VALUE = {i}\n\n\ndef function():\n    return VALUE\n')
+
+    return plugin_count
+
+
+def benchmark_plugins(file_counts: tuple[int, ...] = DEFAULT_PLUGIN_FILES) -> dict:
+    """
+    Measures plugin discovery time over synthetic plugin trees.
+
+    :param file_counts: number of files of each synthetic tree.
+    :return: dictionary with the file counts as keys and the measurements as values.
+    """
+
+    from ..python import plugin
+
+    report: dict[str, Any] = {}
+    for file_count in sorted(set(file_counts)):
+        root = tempfile.mkdtemp(prefix='tp_benchmark_discovery_')
+        try:
+            plugin_count = create_plugin_tree(root, file_count)
+            factory = plugin.PluginFactory(interface=plugin.Plugin)
+            start = time.perf_counter()
+            _, found = factory.register_path(
+                root, package_name='benchmark', mechanism=plugin.PluginFactory.PluginLoadingMechanism.LOAD_SOURCE)
+            elapsed = (time.perf_counter() - start) * 1000.0
+            report[str(file_count)] = {
+                'register_path_ms': elapsed, 'per_file_ms': elapsed / file_count, 'plugins': plugin_count,
+                'found': len(found)}
+        finally:
+            shutil.rmtree(root, ignore_errors=True)
+
+    return report
+
+
+def benchmark_callbacks(
+        callback_counts: tuple[int, ...] = DEFAULT_CALLBACK_COUNTS, dispatch_count: int = DEFAULT_DISPATCH_COUNT,
+        repeat: int = DEFAULT_REPEAT) -> dict:
+    """
+    Measures DCC callbacks dispatch over the standalone backend.
+
+    :param callback_counts: number of registered callbacks to measure with.
+    :param dispatch_count: number of notifications per measurement.
+    :param repeat: number of times each measurement is repeated.
+    :return: dictionary with the registered callback counts as keys and the measurements as values.
+    """
+
+    from ..dcc.abstract import callback as abstract_callback
+    from ..dcc.standalone import callback
+
+    report: dict[str, Any] = {'dispatches': dispatch_count}
+    for callback_count in sorted(set(callback_counts)):
+        fn_callback = callback.FnCallback()
+        received = [0]
+
+        def _on_node_added(*args):
+            received[0] += 1
+
+        start = time.perf_counter()
+        for _ in range(callback_count):
+            fn_callback.add_node_added_callback(_on_node_added)
+        register_ms = (time.perf_counter() - start) * 1000.0
+
+        def _dispatch():
+            for i in range(dispatch_count):
+                callback.notify(abstract_callback.Callback.NodeAdded, i)
+
+        result = measure(_dispatch, repeat=repeat)
+        fn_callback.clear()
+        report[str(callback_count)] = {
+            'register_ms': register_ms,
+            'dispatch_ms': result['median_ms'],
+            'per_dispatch_us': result['median_ms'] * 1000.0 / dispatch_count,
+            'calls': received[0]
+        }
+
+    return report
+
+
+def run(
+        sections: tuple[str, ...] = SECTIONS, repeat: int = DEFAULT_REPEAT, count: int = DEFAULT_COUNT,
+        property_counts: tuple[int, ...] = DEFAULT_PROPERTY_COUNTS,
+        plugin_files: tuple[int, ...] = DEFAULT_PLUGIN_FILES) -> dict:
+    """
+    Runs the given benchmark sections.
+
+    :param sections: names of the sections to run.
+    :param repeat: number of times each measurement is repeated.
+    :param count: number of widgets created per factory measurement.
+    :param property_counts: number of tool properties to measure tool lifecycle with.
+    :param plugin_files: number of files of each synthetic plugin tree.
+    :return: benchmark report.
+    """
+
+    report: dict[str, Any] = {
+        'version': REPORT_VERSION,
+        'timestamp': time.strftime('%Y-%m-%dT%H:%M:%S'),
+        'python': platform.python_version(),
+        'platform': platform.platform(),
+        'repeat': repeat,
+        'sections': {}
+    }
+    if any(section in QT_SECTIONS for section in sections):
+        from ..externals.Qt import __binding__, __qt_version__
+        report['qt'] = {'binding': __binding__, 'version': __qt_version__}
+
+    section_functions: dict[str, Callable[[], dict]] = {
+        'factory': lambda: benchmark_factory(count=count, repeat=repeat),
+        'tool': lambda: benchmark_tool(property_counts=property_counts, repeat=repeat),
+        'icons': lambda: benchmark_icons(repeat=repeat),
+        'plugins': lambda: benchmark_plugins(file_counts=plugin_files),
+        'callbacks': lambda: benchmark_callbacks(repeat=repeat)
+    }
+    for section in sections:
+        logger.info(f'Running benchmark section: {section}')
+        start = time.perf_counter()
+        report['sections'][section] = section_functions[section]()
+        logger.info(f'Benchmark section "{section}" finished in {time.perf_counter() - start:.2f} s')
+
+    return report
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Runs tp-dcc headless benchmark suite.')
+    parser.add_argument('--sections', nargs='+', default=list(SECTIONS), choices=SECTIONS, help='Sections to run.')
+    parser.add_argument('--repeat', type=int, default=DEFAULT_REPEAT, help='Times each measurement is repeated.')
+    parser.add_argument('--count', type=int, default=DEFAULT_COUNT, help='Widgets created per factory measurement.')
+    parser.add_argument(
+        '--properties', nargs='+', type=int, default=list(DEFAULT_PROPERTY_COUNTS),
+        help='Tool property counts to measure tool lifecycle with.')
+    parser.add_argument(
+        '--plugin-files', nargs='+', type=int, default=list(DEFAULT_PLUGIN_FILES),
+        help='File counts of the synthetic plugin trees.')
+    parser.add_argument('--output', default='', help='Optional JSON file path to write the report to.')
+    parsed_args = parser.parse_args(args)
+
+    app = None
+    if any(section in QT_SECTIONS for section in parsed_args.sections):
+        os.environ.setdefault('QT_QPA_PLATFORM', 'offscreen')
+        from ..externals.Qt.QtWidgets import QApplication
+        app = QApplication.instance() or QApplication(sys.argv[:1])
+
+    report = run(
+        sections=tuple(parsed_args.sections), repeat=parsed_args.repeat, count=parsed_args.count,
+        property_counts=tuple(parsed_args.properties), plugin_files=tuple(parsed_args.plugin_files))
+    contents = json.dumps(report, indent=4)
+    if parsed_args.output:
+        with open(parsed_args.output, 'w') as f:
+            f.write(contents)
+        logger.info(f'Benchmark report written to: {parsed_args.output}')
+    else:
+        print(contents)
+    del app
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,436 @@
+"""
+Precomputed catalog of tools, so launchers, menus and shelves can list and search tools without importing any tool
+module.
+
+Catalog is generated when tool paths are registered (tool modules are imported only once, to read their class
+properties) and persisted as JSON together with a signature of the registered tool files. While the signature
+matches, loading the catalog only reads that JSON file.
+
+Usage (from the repository root folder):
+    python -m tp.core.catalog /path/to/tools --output tools.json
+    python -m tp.core.catalog /path/to/tools --search "rename"
+"""
+
+from __future__ import annotations
+
+import os
+import sys
+import json
+import bisect
+import hashlib
+import logging
+import argparse
+import platform
+from typing import Type, Iterable
+from dataclasses import dataclass, field, asdict
+
+from .. import dcc
+from ..python import plugin
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+CATALOG_VERSION = 1
+_SEPARATORS = str.maketrans({character: ' ' for character in '_-./\\:,;()[]'})
+
+
+@dataclass
+class ToolEntry:
+    """
+    Class that stores the information of a tool that is needed to list, search and launch it.
+
+    Attributes
+    ----------
+    id : str
+        unique tool identifier.
+    label : str
+        tool label, as defined by its UI data.
+    icon : str
+        tool icon, as defined by its UI data.
+    tooltip : str
+        tool tooltip, as defined by its UI data.
+    tags : list[str]
+        tool tags.
+    creator : str
+        tool creator.
+    path : str
+        absolute path of the file where the tool class is defined.
+    class_name : str
+        name of the tool class.
+    """
+
+    id: str
+    label: str = ''
+    icon: str = ''
+    tooltip: str = ''
+    tags: list[str] = field(default_factory=list)
+    creator: str = ''
+    path: str = ''
+    class_name: str = ''
+
+    @classmethod
+    def from_tool_class(cls, tool_class: Type) -> ToolEntry:
+        """
+        Returns the entry of the given tool class, evaluating its class properties.
+
+        :param tool_class: tool class.
+        :return: tool entry.
+        """
+
+        ui_data = tool_class.ui_data
+        return cls(
+            id=tool_class.id or tool_class.ID, label=ui_data.label, icon=ui_data.icon, tooltip=ui_data.tooltip,
+            tags=list(tool_class.tags), creator=tool_class.creator, path=getattr(tool_class, 'PATH', ''),
+            class_name=tool_class.__name__)
+
+    def tokens(self) -> set[str]:
+        """
+        Returns the lowercase words this entry can be searched by.
+
+        :return: set of search tokens.
+        """
+
+        text = ' '.join([self.id, self.label, self.tooltip, self.creator] + self.tags)
+        return set(text.translate(_SEPARATORS).lower().split())
+
+
+class ToolCatalog:
+    """
+    Class that stores the entries of all registered tools, indexed by tag and by search token.
+    """
+
+    def __init__(self, entries: Iterable[ToolEntry] = (), signature: str = ''):
+        self._entries: dict[str, ToolEntry] = {}
+        self._signature = signature
+        self._by_tag: dict[str, list[str]] = {}
+        self._by_token: dict[str, set[str]] = {}
+        self._sorted_tokens: list[str] = []
+        for entry in entries:
+            self._entries[entry.id] = entry
+        self._build_index()
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def __contains__(self, tool_id: str) -> bool:
+        return tool_id in self._entries
+
+    @property
+    def signature(self) -> str:
+        """
+        Returns the signature of the tool files this catalog was generated from.
+
+        :return: tool files signature.
+        """
+
+        return self._signature
+
+    @classmethod
+    def build(cls, paths: list[str], factory: plugin.PluginFactory | None = None) -> ToolCatalog:
+        """
+        Returns a new catalog with all the tools found within the given paths. Tool modules are imported.
+
+        :param paths: absolute folder or file paths to search tools in.
+        :param factory: optional factory used to register the paths. If not given, a new tool factory is used.
+        :return: tool catalog.
+        """
+
+        if factory is None:
+            from . import tool
+            factory = plugin.PluginFactory(interface=tool.Tool, plugin_id='ID')
+        tool_classes = factory.register_paths(paths)
+
+        return cls.from_tool_classes(tool_classes, signature=files_signature(paths))
+
+    @classmethod
+    def from_tool_classes(cls, tool_classes: Iterable[Type], signature: str = '') -> ToolCatalog:
+        """
+        Returns a new catalog with the given tool classes.
+
+        :param tool_classes: tool classes (e.g: the plugins found by a tool factory).
+        :param signature: optional signature of the tool files classes were found in.
+        :return: tool catalog.
+        """
+
+        entries: list[ToolEntry] = []
+        for tool_class in tool_classes:
+            # noinspection PyBroadException
+            try:
+                entry = ToolEntry.from_tool_class(tool_class)
+            except Exception:
+                logger.warning(f'Impossible to add tool "{tool_class}" to catalog', exc_info=True)
+                continue
+            if not entry.id:
+                logger.warning(f'Tool "{tool_class.__name__}" has no identifier and is not added to catalog')
+                continue
+            entries.append(entry)
+
+        return cls(entries, signature=signature)
+
+    @classmethod
+    def load(cls, file_path: str) -> ToolCatalog | None:
+        """
+        Loads a catalog from the given JSON file.
+
+        :param file_path: absolute catalog file path.
+        :return: loaded catalog or None if file does not exist or is not a valid catalog.
+        """
+
+        try:
+            with open(file_path, 'r') as f:
+                data = json.load(f)
+            if data.get('version') != CATALOG_VERSION:
+                return None
+            return cls([ToolEntry(**entry) for entry in data['tools']], signature=data.get('signature', ''))
+        except (OSError, ValueError, KeyError, TypeError):
+            return None
+
+    @classmethod
+    def load_or_build(cls, paths: list[str], file_path: str = '') -> ToolCatalog:
+        """
+        Loads the catalog persisted in the given file if it was generated from the current tool files. Otherwise,
+        the catalog is built (importing tool modules) and persisted.
+
+        :param paths: absolute folder or file paths to search tools in.
+        :param file_path: optional catalog file path. If not given, a file within user cache folder is used.
+        :return: tool catalog.
+        """
+
+        file_path = file_path or catalog_path(paths)
+        found_catalog = cls.load(file_path)
+        if found_catalog is not None and found_catalog.signature == files_signature(paths):
+            return found_catalog
+
+        found_catalog = cls.build(paths)
+        found_catalog.save(file_path)
+
+        return found_catalog
+
+    def save(self, file_path: str):
+        """
+        Persists this catalog into the given JSON file.
+
+        :param file_path: absolute catalog file path.
+        """
+
+        data = {
+            'version': CATALOG_VERSION, 'signature': self._signature,
+            'tools': [asdict(entry) for entry in self._entries.values()]}
+        try:
+            os.makedirs(os.path.dirname(file_path), exist_ok=True)
+            with open(file_path, 'w') as f:
+                json.dump(data, f, indent=4)
+        except OSError as exc:
+            logger.warning(f'Impossible to save tool catalog: {exc}')
+
+    def entries(self) -> list[ToolEntry]:
+        """
+        Returns all the catalog entries, sorted by label.
+
+        :return: tool entries.
+        """
+
+        return sorted(self._entries.values(), key=lambda entry: (entry.label or entry.id).lower())
+
+    def entry(self, tool_id: str) -> ToolEntry | None:
+        """
+        Returns the entry of the tool with given identifier.
+
+        :param tool_id: tool identifier.
+        :return: tool entry or None if tool is not in the catalog.
+        """
+
+        return self._entries.get(tool_id)
+
+    def tags(self) -> list[str]:
+        """
+        Returns all the tags used by catalog tools, sorted alphabetically.
+
+        :return: tool tags.
+        """
+
+        return sorted(self._by_tag)
+
+    def by_tag(self, tag: str) -> list[ToolEntry]:
+        """
+        Returns the entries of the tools with the given tag, sorted by label.
+
+        :param tag: tag to search for (case-insensitive).
+        :return: tool entries.
+        """
+
+        return self._sorted([self._entries[tool_id] for tool_id in self._by_tag.get(tag.lower(), [])])
+
+    def search(self, text: str = '', tags: Iterable[str] | None = None) -> list[ToolEntry]:
+        """
+        Returns the entries of the tools that match the given text and tags. Each word of the text must be the
+        beginning of a word of the tool identifier, label, tooltip, creator or tags, so results can be updated while
+        the user types.
+
+        :param text: text to search for (case-insensitive).
+        :param tags: optional tags tools must have (all of them).
+        :return: matching tool entries. Tools whose label starts with the text are returned first.
+        """
+
+        matching: set[str] | None = None
+        for tag in tags or ():
+            tagged = set(self._by_tag.get(tag.lower(), ()))
+            matching = tagged if matching is None else matching & tagged
+        words = text.translate(_SEPARATORS).lower().split()
+        for word in words:
+            found = self._prefix_matches(word)
+            matching = found if matching is None else matching & found
+            if not matching:
+                return []
+        if matching is None:
+            return self.entries()
+
+        found_entries = self._sorted([self._entries[tool_id] for tool_id in matching])
+        if not text:
+            return found_entries
+        text = text.lower()
+        return sorted(found_entries, key=lambda entry: not (entry.label or entry.id).lower().startswith(text))
+
+    def tool_class(self, tool_id: str) -> Type | None:
+        """
+        Imports and returns the class of the tool with given identifier. Only the module of that tool is imported.
+
+        :param tool_id: tool identifier.
+        :return: tool class or None if tool is not in the catalog or its module cannot be imported.
+        """
+
+        entry = self._entries.get(tool_id)
+        if entry is None:
+            return None
+        module = plugin.PluginFactory.plugin_module(entry.path)
+        tool_class = getattr(module, entry.class_name, None) if module is not None else None
+        if tool_class is None:
+            logger.error(f'Impossible to import tool "{tool_id}" from: {entry.path}')
+            return None
+        tool_class.PATH = entry.path
+        tool_class.MODULE = module
+
+        return tool_class
+
+    def _build_index(self):
+        """
+        Internal function that builds the tag and search token indexes.
+        """
+
+        self._by_tag.clear()
+        self._by_token.clear()
+        for tool_id, entry in self._entries.items():
+            for tag in entry.tags:
+                self._by_tag.setdefault(tag.lower(), []).append(tool_id)
+            for token in entry.tokens():
+                self._by_token.setdefault(token, set()).add(tool_id)
+        self._sorted_tokens = sorted(self._by_token)
+
+    def _prefix_matches(self, prefix: str) -> set[str]:
+        """
+        Internal function that returns the identifiers of the tools with any search token starting with given prefix.
+
+        :param prefix: lowercase prefix.
+        :return: set of tool identifiers.
+        """
+
+        found: set[str] = set()
+        index = bisect.bisect_left(self._sorted_tokens, prefix)
+        while index < len(self._sorted_tokens) and self._sorted_tokens[index].startswith(prefix):
+            found.update(self._by_token[self._sorted_tokens[index]])
+            index += 1
+
+        return found
+
+    @staticmethod
+    def _sorted(entries: list[ToolEntry]) -> list[ToolEntry]:
+        """
+        Internal function that sorts given entries by label.
+
+        :param entries: entries to sort.
+        :return: sorted entries.
+        """
+
+        return sorted(entries, key=lambda entry: (entry.label or entry.id).lower())
+
+
+def files_signature(paths: list[str]) -> str:
+    """
+    Returns a signature of the files inspected when registering the given tool paths. Signature changes when any of
+    those files is added, removed or modified.
+
+    :param paths: absolute folder or file paths.
+    :return: files signature.
+    """
+
+    sha = hashlib.sha1()
+    for path in sorted(set(paths)):
+        for file_path in sorted(plugin.PluginFactory.candidate_files(path)):
+            try:
+                stat = os.stat(file_path)
+            except OSError:
+                continue
+            sha.update(f'{file_path}|{stat.st_mtime_ns}|{stat.st_size}\n'.encode('utf-8'))
+
+    return sha.hexdigest()
+
+
+def catalog_path(paths: list[str]) -> str:
+    """
+    Returns the default file where the catalog of the given tool paths is persisted. Each DCC gets its own catalog,
+    because the tools found within the same paths can differ depending on the DCC they are discovered from.
+
+    :param paths: absolute folder or file paths.
+    :return: absolute catalog file path.
+    """
+
+    if platform.system().lower() == 'windows':
+        root = os.environ.get('LOCALAPPDATA') or os.path.expanduser('~')
+    else:
+        root = os.environ.get('XDG_CACHE_HOME') or os.path.join(os.path.expanduser('~'), '.cache')
+    key = hashlib.sha1(
+        os.pathsep.join([dcc.current_dcc()] + sorted(set(paths))).encode('utf-8')).hexdigest()[:16]
+
+    return os.path.join(root, 'tp', 'catalogs', f'{key}.json')
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Generates and searches tp-dcc tools catalog.')
+    parser.add_argument('paths', nargs='+', help='Folders or files to search tools in.')
+    parser.add_argument('--output', default='', help='Catalog file path. User cache folder is used if not given.')
+    parser.add_argument('--rebuild', action='store_true', help='Rebuilds catalog even if tool files did not change.')
+    parser.add_argument('--search', default=None, help='Text to search tools by.')
+    parser.add_argument('--tag', action='append', default=[], help='Tag searched tools must have. Can be repeated.')
+    parsed_args = parser.parse_args(args)
+
+    paths = [os.path.abspath(path) for path in parsed_args.paths]
+    file_path = parsed_args.output or catalog_path(paths)
+    if parsed_args.rebuild:
+        tool_catalog = ToolCatalog.build(paths)
+        tool_catalog.save(file_path)
+    else:
+        tool_catalog = ToolCatalog.load_or_build(paths, file_path=file_path)
+    logger.info(f'{len(tool_catalog)} tools in catalog: {file_path}')
+
+    if parsed_args.search is not None or parsed_args.tag:
+        for entry in tool_catalog.search(parsed_args.search or '', tags=parsed_args.tag):
+            print(f'{entry.id}: {entry.label} [{", ".join(entry.tags)}]')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
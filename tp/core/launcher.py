@@ -0,0 +1,258 @@
+"""
+Standalone tool launcher optimized for time-to-first-window.
+
+The Qt binding is pinned (the binding found by the previous launch is cached, so Qt.py does not probe all the
+bindings), a lightweight splash window is shown as soon as the QApplication exists and tool modules, plugin discovery,
+theme stylesheets and icon resources are only loaded after the splash has been painted.
+
+Usage (from the repository root folder):
+    python -m tp.core.launcher my_package.tools.my_tool:MyTool
+    python -m tp.core.launcher myToolId --plugin-path /path/to/tools --report startup.json
+"""
+
+from __future__ import annotations
+
+import time
+
+# start time is taken before any other import, so it includes the launcher own imports.
+_START_TIME = time.perf_counter()
+
+import os
+import sys
+import json
+import logging
+import argparse
+import platform
+import importlib
+from typing import Type
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+BINDING_ENV_VAR = 'QT_PREFERRED_BINDING'
+QT_MODULE = f'{__package__.rpartition(".")[0]}.externals.Qt'
+
+
+def binding_cache_path() -> str:
+    """
+    Returns the path of the file where the Qt binding found by the last launch is cached.
+
+    :return: absolute binding cache file path.
+    """
+
+    if platform.system().lower() == 'windows':
+        root = os.environ.get('LOCALAPPDATA') or os.path.expanduser('~')
+    else:
+        root = os.environ.get('XDG_CACHE_HOME') or os.path.join(os.path.expanduser('~'), '.cache')
+
+    return os.path.join(root, 'tp', 'qt_binding.json')
+
+
+def cached_binding() -> str:
+    """
+    Returns the Qt binding found by the last launch done with the current Python executable.
+
+    :return: Qt binding name (e.g: PySide6) or an empty string if no binding is cached.
+    """
+
+    try:
+        with open(binding_cache_path(), 'r') as f:
+            return json.load(f).get(sys.executable, '')
+    except (OSError, ValueError):
+        return ''
+
+
+def cache_binding(binding: str):
+    """
+    Stores given Qt binding as the one to use by the next launches done with the current Python executable.
+
+    :param binding: Qt binding name (e.g: PySide6).
+    """
+
+    file_path = binding_cache_path()
+    try:
+        with open(file_path, 'r') as f:
+            data = json.load(f)
+    except (OSError, ValueError):
+        data = {}
+    if data.get(sys.executable) == binding:
+        return
+
+    data[sys.executable] = binding
+    try:
+        os.makedirs(os.path.dirname(file_path), exist_ok=True)
+        with open(file_path, 'w') as f:
+            json.dump(data, f, indent=4)
+    except OSError as exc:
+        logger.warning(f'Impossible to cache Qt binding: {exc}')
+
+
+def pin_binding(binding: str = '') -> str:
+    """
+    Pins the Qt binding Qt.py will use, through QT_PREFERRED_BINDING environment variable. Must be called before
+    Qt.py is imported.
+
+    :param binding: optional binding to use. If not given, the environment variable value is respected and, if not
+        defined, the binding found by the last launch is used.
+    :return: pinned binding or an empty string if Qt.py will probe all the bindings.
+    """
+
+    binding = binding or os.environ.get(BINDING_ENV_VAR, '') or cached_binding()
+    if binding:
+        os.environ[BINDING_ENV_VAR] = binding
+
+    return binding
+
+
+def import_qt(binding: str = '') -> str:
+    """
+    Imports Qt.py with the given pinned binding. If the pinned binding cannot be imported, all the bindings are
+    probed again.
+
+    :param binding: pinned binding.
+    :return: name of the imported binding.
+    """
+
+    try:
+        qt = importlib.import_module(QT_MODULE)
+    except ImportError:
+        if not binding:
+            raise
+        logger.warning(f'Pinned Qt binding "{binding}" is not available, probing all bindings')
+        os.environ.pop(BINDING_ENV_VAR, None)
+        sys.modules.pop(QT_MODULE, None)
+        qt = importlib.import_module(QT_MODULE)
+
+    # noinspection PyUnresolvedReferences
+    found_binding = qt.__binding__
+    cache_binding(found_binding)
+
+    return found_binding
+
+
+def load_tool_class(tool: str, plugin_paths: list[str] | None = None) -> Type:
+    """
+    Returns the tool class defined by the given import path or tool identifier.
+
+    :param tool: tool class import path (e.g: my_package.tools.my_tool:MyTool) or tool identifier.
+    :param plugin_paths: paths where tools are discovered when a tool identifier is given.
+    :return: tool class.
+    :raises ValueError: if no tool with given identifier is found.
+    """
+
+    if ':' in tool:
+        module_name, _, class_name = tool.partition(':')
+        return getattr(importlib.import_module(module_name), class_name)
+
+    # catalog is only rebuilt (importing all tool modules) when tool files changed since last launch.
+    from . import catalog
+
+    tool_class = catalog.ToolCatalog.load_or_build(plugin_paths or []).tool_class(tool)
+    if tool_class is None:
+        raise ValueError(f'Tool "{tool}" not found within: {plugin_paths}')
+
+    return tool_class
+
+
+def elapsed_ms() -> float:
+    """
+    Returns the time elapsed since the launcher was imported.
+
+    :return: elapsed time, in milliseconds.
+    """
+
+    return (time.perf_counter() - _START_TIME) * 1000.0
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: Qt application exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Launches a tp-dcc tool as a standalone application.')
+    parser.add_argument('tool', help='Tool class import path (e.g: package.module:ToolClass) or tool identifier.')
+    parser.add_argument(
+        '--plugin-path', action='append', default=[], help='Path where tools are discovered. Can be repeated.')
+    parser.add_argument('--binding', default='', help='Qt binding to use (e.g: PySide6).')
+    parser.add_argument('--title', default='', help='Splash window title. Tool argument is used if not given.')
+    parser.add_argument('--report', default='', help='Optional JSON file path to write startup timings to.')
+    parser.add_argument(
+        '--exit-after-show', action='store_true', help='Quits once tool window is painted (to measure startup).')
+    parsed_args = parser.parse_args(args)
+
+    from .. import dcc
+    if dcc.current_dcc() != dcc.Standalone:
+        logger.error('Launcher can only be used in standalone mode. Use Tool.execute within DCCs.')
+        return 1
+
+    timings: dict[str, float] = {}
+    binding = pin_binding(parsed_args.binding)
+    binding = import_qt(binding)
+    timings['qt_import_ms'] = elapsed_ms()
+
+    from ..externals.Qt.QtCore import QTimer
+    from ..externals.Qt.QtWidgets import QApplication
+    from ..qt import settings
+    from ..qt.widgets import splash
+
+    app = QApplication.instance() or QApplication(sys.argv[:1])
+    timings['application_ms'] = elapsed_ms()
+    # window settings files are loaded by a background thread while the splash is shown.
+    settings.settings_store()
+    splash_window = splash.SplashWindow(title=parsed_args.title or parsed_args.tool)
+    state: dict[str, object] = {}
+
+    def _on_splash_painted():
+        timings['first_window_ms'] = elapsed_ms()
+        logger.info(f'Time to first window: {timings["first_window_ms"]:.1f} ms ({binding})')
+        QTimer.singleShot(0, _load_tool)
+
+    def _load_tool():
+        splash_window.set_message('Loading tool...')
+        try:
+            tool_class = load_tool_class(parsed_args.tool, plugin_paths=parsed_args.plugin_path)
+            timings['tool_import_ms'] = elapsed_ms()
+            splash_window.set_message('Building window...')
+            tool_instance = tool_class()
+            window = tool_instance.execute()
+        except Exception:
+            logger.exception(f'Error while launching tool: {parsed_args.tool}')
+            splash_window.close()
+            app.exit(1)
+            return
+        timings['tool_execute_ms'] = elapsed_ms()
+        state['tool'] = tool_instance
+        state['window'] = window
+        splash.call_after_first_paint(window, _on_tool_window_painted)
+
+    def _on_tool_window_painted():
+        timings['tool_window_ms'] = elapsed_ms()
+        splash_window.close()
+        splash_window.deleteLater()
+        logger.info(', '.join(f'{key}: {value:.1f}' for key, value in timings.items()))
+        if parsed_args.report:
+            with open(parsed_args.report, 'w') as f:
+                json.dump(dict(tool=parsed_args.tool, binding=binding, **timings), f, indent=4)
+            logger.info(f'Startup report written to: {parsed_args.report}')
+        if parsed_args.exit_after_show:
+            app.quit()
+
+    # tool is loaded from the event loop iteration after the splash first paint, so splash is already on screen.
+    splash_window.firstPainted.connect(_on_splash_painted)
+    splash_window.show_centered()
+
+    # noinspection PyUnresolvedReferences
+    return app.exec_()
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,401 @@
+"""
+Leak tracking harness that opens and closes a tool many times headless and reports the Python and Qt objects that
+are retained after each cycle, together with the referrer chains that keep tool and window objects alive.
+
+Usage (from the repository root folder):
+    python -m tp.core.leaks --cycles 20 --output leaks.json
+    python -m tp.core.leaks --tool my_package.tools.my_tool:MyTool --max-growth-kb 64
+"""
+
+from __future__ import annotations
+
+import gc
+import os
+import sys
+import json
+import types
+import weakref
+import logging
+import argparse
+import importlib
+import tracemalloc
+import collections
+from typing import Any, Type
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+DEFAULT_CYCLES = 10
+DEFAULT_WARMUP = 2
+DEFAULT_PROPERTIES = 50
+MAX_CHAIN_DEPTH = 8
+MAX_CHAINS = 5
+TOP_TYPES = 20
+TOP_ALLOCATIONS = 10
+
+
+def collect():
+    """
+    Processes pending Qt deferred deletions and runs the Python garbage collector until nothing else is freed.
+    """
+
+    from ..externals.Qt.QtCore import QEvent
+    from ..externals.Qt.QtWidgets import QApplication
+
+    for _ in range(3):
+        QApplication.sendPostedEvents(None, QEvent.DeferredDelete)
+        QApplication.processEvents()
+        if not gc.collect():
+            break
+
+
+def python_object_counts() -> collections.Counter:
+    """
+    Returns the number of live Python objects tracked by the garbage collector, by type.
+
+    :return: counter with the qualified type names as keys.
+    """
+
+    return collections.Counter(f'{type(obj).__module__}.{type(obj).__qualname__}' for obj in gc.get_objects())
+
+
+def qt_object_counts() -> collections.Counter:
+    """
+    Returns the number of live Qt objects (widgets and non-widget objects such as timers, actions or models), by class.
+
+    Objects are found within the children of the application and of all the widgets, and within the Python wrappers
+    tracked by the garbage collector, so parentless non-widget objects kept alive from Python are counted too.
+
+    :return: counter with the object class names as keys.
+    """
+
+    from ..externals.Qt.QtCore import QObject
+    from ..externals.Qt.QtWidgets import QApplication
+
+    objects: dict[int, QObject] = {}
+    app = QApplication.instance()
+    roots = [app] if app is not None else []
+    roots.extend(QApplication.topLevelWidgets())
+    for root in roots:
+        try:
+            objects[id(root)] = root
+            objects.update((id(child), child) for child in root.findChildren(QObject))
+        except RuntimeError:
+            continue
+    for widget in QApplication.allWidgets():
+        objects[id(widget)] = widget
+    for obj in gc.get_objects():
+        if isinstance(obj, QObject):
+            objects[id(obj)] = obj
+
+    counts: collections.Counter = collections.Counter()
+    for obj in objects.values():
+        try:
+            # deleted C++ objects raise when accessed.
+            obj.objectName()
+        except RuntimeError:
+            continue
+        counts[type(obj).__name__] += 1
+
+    return counts
+
+
+def describe(obj: Any) -> str:
+    """
+    Returns a short description of the given object, to be used within referrer chains.
+
+    :param obj: object to describe.
+    :return: object description.
+    """
+
+    if isinstance(obj, types.ModuleType):
+        return f'module {obj.__name__}'
+    elif isinstance(obj, types.FunctionType):
+        return f'function {obj.__module__}.{obj.__qualname__}'
+    elif isinstance(obj, types.MethodType):
+        return f'bound method {obj.__func__.__qualname__}'
+    elif isinstance(obj, type):
+        return f'class {obj.__module__}.{obj.__qualname__}'
+    elif isinstance(obj, types.CellType):
+        return 'closure cell'
+    elif isinstance(obj, (dict, list, tuple, set)):
+        return f'{type(obj).__name__} (len={len(obj)})'
+
+    return f'{type(obj).__module__}.{type(obj).__qualname__}'
+
+
+def referrer_chains(
+        target: Any, max_depth: int = MAX_CHAIN_DEPTH, max_chains: int = MAX_CHAINS) -> list[list[str]]:
+    """
+    Returns the chains of objects that keep given object alive, from the object to a root (a module, a class or an
+    object that is not referred by any other tracked object).
+
+    :param target: object to find referrers of.
+    :param max_depth: maximum chain length.
+    :param max_chains: maximum number of chains to return.
+    :return: list of chains. Each chain is a list of object descriptions, starting with the given object.
+    """
+
+    ignored = {id(sys._getframe())}
+    chains: list[list[str]] = []
+    queue: collections.deque[list[Any]] = collections.deque([[target]])
+    visited = {id(target)}
+    ignored.add(id(queue))
+    ignored.add(id(visited))
+    # lists created while searching refer to the objects of the chains, so they are ignored. They are kept alive until
+    # search finishes, so their ids are not reused by other objects.
+    created: list[list[Any]] = [queue[0]]
+    ignored.add(id(created))
+    ignored.add(id(queue[0]))
+    while queue and len(chains) < max_chains:
+        path = queue.popleft()
+        current = path[-1]
+        if len(path) > max_depth or isinstance(current, (types.ModuleType, type)):
+            chains.append([describe(obj) for obj in path])
+            continue
+        referrers = [
+            referrer for referrer in gc.get_referrers(current)
+            if id(referrer) not in ignored and not isinstance(referrer, types.FrameType) and referrer is not chains]
+        created.append(referrers)
+        ignored.add(id(referrers))
+        if not referrers:
+            chains.append([describe(obj) for obj in path])
+            continue
+        for referrer in referrers:
+            if id(referrer) in visited:
+                continue
+            visited.add(id(referrer))
+            # module globals dictionaries are reported as their module.
+            module = _module_of_globals(referrer)
+            new_path = path + [module if module is not None else referrer]
+            created.append(new_path)
+            ignored.add(id(new_path))
+            queue.append(new_path)
+        del referrers
+    del created
+
+    return chains
+
+
+def _module_of_globals(obj: Any) -> types.ModuleType | None:
+    """
+    Internal function that returns the module whose globals dictionary is the given object.
+
+    :param obj: object to check.
+    :return: module or None if given object is not a module globals dictionary.
+    """
+
+    if not isinstance(obj, dict) or '__name__' not in obj:
+        return None
+    module = sys.modules.get(obj['__name__'])
+
+    return module if module is not None and getattr(module, '__dict__', None) is obj else None
+
+
+def load_tool_class(path: str) -> Type:
+    """
+    Returns the tool class defined by the given import path.
+
+    :param path: tool class import path (e.g: my_package.tools.my_tool:MyTool).
+    :return: tool class.
+    """
+
+    module_name, _, class_name = path.partition(':')
+    if not class_name:
+        module_name, _, class_name = path.rpartition('.')
+
+    return getattr(importlib.import_module(module_name), class_name)
+
+
+def run(tool_class: Type, cycles: int = DEFAULT_CYCLES, warmup: int = DEFAULT_WARMUP) -> dict:
+    """
+    Opens and closes given tool the given number of times and reports the objects retained after each cycle.
+
+    :param tool_class: tool class to open and close.
+    :param cycles: number of measured open and close cycles.
+    :param warmup: number of open and close cycles done before measuring, so caches and singletons are filled.
+    :return: leak report.
+    """
+
+    from ..externals.Qt.QtWidgets import QApplication
+    from ..qt.widgets import frameless
+
+    def _cycle() -> tuple[weakref.ref, weakref.ref]:
+        tool_instance = tool_class()
+        window = tool_instance.execute()
+        QApplication.processEvents()
+        window.close()
+        tool_instance._run_teardown()
+        window.deleteLater()
+        return weakref.ref(tool_instance), weakref.ref(window)
+
+    for _ in range(warmup):
+        _cycle()
+    collect()
+
+    if not tracemalloc.is_tracing():
+        tracemalloc.start(25)
+    baseline_snapshot = tracemalloc.take_snapshot()
+    previous_memory = baseline_memory = tracemalloc.get_traced_memory()[0]
+    previous_objects = baseline_objects = python_object_counts()
+    previous_qt_objects = baseline_qt_objects = qt_object_counts()
+
+    report: dict[str, Any] = {
+        'tool': f'{tool_class.__module__}.{tool_class.__qualname__}', 'cycles': cycles, 'warmup': warmup,
+        'per_cycle': [], 'retained_tools': [], 'retained_windows': []}
+    alive_tools: list[weakref.ref] = []
+    alive_windows: list[weakref.ref] = []
+    for i in range(cycles):
+        tool_ref, window_ref = _cycle()
+        collect()
+        memory = tracemalloc.get_traced_memory()[0]
+        objects = python_object_counts()
+        qt_objects = qt_object_counts()
+        object_diff = objects - previous_objects
+        qt_object_diff = qt_objects - previous_qt_objects
+        report['per_cycle'].append({
+            'cycle': i,
+            'memory_kb': (memory - previous_memory) / 1024.0,
+            'python_objects': sum(objects.values()) - sum(previous_objects.values()),
+            'qt_objects': sum(qt_objects.values()) - sum(previous_qt_objects.values()),
+            'frameless_instances': len(frameless.FramelessWindow._INSTANCES),
+            'tool_alive': tool_ref() is not None,
+            'window_alive': window_ref() is not None,
+            'top_python_types': dict(object_diff.most_common(TOP_TYPES)),
+            'top_qt_classes': dict(qt_object_diff.most_common(TOP_TYPES))
+        })
+        previous_memory, previous_objects, previous_qt_objects = memory, objects, qt_objects
+        if tool_ref() is not None:
+            alive_tools.append(tool_ref)
+        if window_ref() is not None:
+            alive_windows.append(window_ref)
+
+    collect()
+    final_memory = tracemalloc.get_traced_memory()[0]
+    final_snapshot = tracemalloc.take_snapshot()
+    final_objects = python_object_counts()
+    final_qt_objects = qt_object_counts()
+    report['total'] = {
+        'memory_kb': (final_memory - baseline_memory) / 1024.0,
+        'memory_kb_per_cycle': (final_memory - baseline_memory) / 1024.0 / max(1, cycles),
+        'python_objects': sum(final_objects.values()) - sum(baseline_objects.values()),
+        'qt_objects': sum(final_qt_objects.values()) - sum(baseline_qt_objects.values()),
+        'top_python_types': dict((final_objects - baseline_objects).most_common(TOP_TYPES)),
+        'top_qt_classes': dict((final_qt_objects - baseline_qt_objects).most_common(TOP_TYPES)),
+        'top_allocations': [
+            {'location': str(stat.traceback[0]), 'size_kb': stat.size_diff / 1024.0, 'count': stat.count_diff}
+            for stat in final_snapshot.compare_to(baseline_snapshot, 'lineno')[:TOP_ALLOCATIONS]]
+    }
+
+    # referrer chains are only computed for the first retained objects, because they are expensive to find.
+    for key, refs in (('retained_tools', alive_tools), ('retained_windows', alive_windows)):
+        for ref in refs[:1]:
+            obj = ref()
+            if obj is not None:
+                report[key].append({'object': describe(obj), 'chains': referrer_chains(obj)})
+                del obj
+        report[key + '_count'] = sum(1 for ref in refs if ref() is not None)
+
+    return report
+
+
+def check_thresholds(report: dict, max_growth_kb: float | None = None, max_objects: int | None = None) -> list[str]:
+    """
+    Returns the threshold violations found in the given leak report.
+
+    :param report: leak report.
+    :param max_growth_kb: optional maximum memory growth per cycle, in kilobytes.
+    :param max_objects: optional maximum number of Python objects retained after all cycles.
+    :return: list of violation messages. Empty if run is within thresholds.
+    """
+
+    violations: list[str] = []
+    total = report['total']
+    if max_growth_kb is not None and total['memory_kb_per_cycle'] > max_growth_kb:
+        violations.append(f'Memory grows {total["memory_kb_per_cycle"]:.2f} KB per cycle (max {max_growth_kb} KB)')
+    if max_objects is not None and total['python_objects'] > max_objects:
+        violations.append(f'{total["python_objects"]} Python objects retained (max {max_objects})')
+
+    return violations
+
+
+def format_report(report: dict) -> str:
+    """
+    Returns a human-readable version of the given leak report.
+
+    :param report: leak report.
+    :return: formatted report.
+    """
+
+    total = report['total']
+    lines = [
+        f'{report["tool"]}: {report["cycles"]} cycles ({report["warmup"]} warmup)',
+        f'    memory: {total["memory_kb"]:+.2f} KB ({total["memory_kb_per_cycle"]:+.2f} KB per cycle)',
+        f'    python objects: {total["python_objects"]:+d}, qt objects: {total["qt_objects"]:+d}',
+        f'    retained tools: {report["retained_tools_count"]}, '
+        f'retained windows: {report["retained_windows_count"]}']
+    for type_name, count in list(total['top_python_types'].items())[:5]:
+        lines.append(f'    {type_name}: {count:+d}')
+    for key in ('retained_tools', 'retained_windows'):
+        for retained in report[key]:
+            lines.append(f'    {retained["object"]} kept alive by:')
+            for chain in retained['chains']:
+                lines.append(f'        {" <- ".join(chain)}')
+
+    return '\n'.join(lines)
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code. 1 if any threshold is exceeded.
+    """
+
+    parser = argparse.ArgumentParser(description='Tracks tp-dcc tools and frameless windows memory leaks.')
+    parser.add_argument(
+        '--tool', default='', help='Tool class import path (e.g: package.module:ToolClass). If not given, a '
+                                   'synthetic tool with linked properties is used.')
+    parser.add_argument(
+        '--properties', type=int, default=DEFAULT_PROPERTIES, help='Properties of the synthetic tool.')
+    parser.add_argument('--cycles', type=int, default=DEFAULT_CYCLES, help='Measured open and close cycles.')
+    parser.add_argument('--warmup', type=int, default=DEFAULT_WARMUP, help='Open and close cycles before measuring.')
+    parser.add_argument('--max-growth-kb', type=float, default=None, help='Maximum memory growth per cycle.')
+    parser.add_argument('--max-objects', type=int, default=None, help='Maximum retained Python objects.')
+    parser.add_argument('--output', default='', help='Optional JSON file path to write the report to.')
+    parsed_args = parser.parse_args(args)
+
+    os.environ.setdefault('QT_QPA_PLATFORM', 'offscreen')
+    from ..externals.Qt.QtWidgets import QApplication
+    app = QApplication.instance() or QApplication(sys.argv[:1])
+
+    if parsed_args.tool:
+        tool_class = load_tool_class(parsed_args.tool)
+    else:
+        from . import benchmark
+        tool_class = benchmark._benchmark_tool_class(parsed_args.properties)
+
+    report = run(tool_class, cycles=parsed_args.cycles, warmup=parsed_args.warmup)
+    violations = check_thresholds(report, max_growth_kb=parsed_args.max_growth_kb, max_objects=parsed_args.max_objects)
+    report['violations'] = violations
+    print(format_report(report))
+    if parsed_args.output:
+        with open(parsed_args.output, 'w') as f:
+            json.dump(report, f, indent=4)
+        logger.info(f'Leak report written to: {parsed_args.output}')
+    for violation in violations:
+        logger.error(violation)
+    del app
+
+    return 1 if violations else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,269 @@
+from __future__ import annotations
+
+import os
+import time
+import asyncio
+import logging
+import threading
+import collections
+from typing import Any, Callable, Sequence
+from concurrent.futures import ThreadPoolExecutor
+
+from ..externals.Qt.QtCore import Signal, QObject
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+DEFAULT_CHUNK_SIZE = 64
+DEFAULT_FRAME_BUDGET = 0.008
+MAX_WORKERS = max(1, min(8, (os.cpu_count() or 2) - 1))
+
+_EXECUTOR: ThreadPoolExecutor | None = None
+
+
+class TaskCancelled(Exception):
+    """
+    Exception raised within task functions when the task was cancelled.
+    """
+
+    pass
+
+
+class ChunkedTask(QObject):
+    """
+    Class that runs a long operation over many items without freezing the UI.
+
+    Items are split into chunks. Each item can have two stages:
+        - prepare: pure compute function (no DCC nor Qt calls) that runs in the worker thread pool. Chunks are
+            prepared ahead, in parallel, while previous chunks are being applied.
+        - apply: function that runs in the main thread (e.g: DCC scene edits). Items are applied within a time budget
+            per event loop iteration, so the viewport and the UI stay responsive.
+
+    Cancellation is cooperative: workers stop between items and no more items are applied once `cancel` is called.
+    Task functions can also call `check_cancelled` to stop earlier.
+
+    ..note:: prepare functions run in threads, so they only run in parallel when they release the GIL (file I/O or C
+        extensions such as numpy). Pure Python prepare functions still keep the UI thread free between chunks, but
+        they run one at a time and share the interpreter with it, so they do not make the task faster.
+    """
+
+    progressChanged = Signal(int, int)
+    messageChanged = Signal(str)
+    finished = Signal(bool)
+
+    def __init__(
+            self, items: Sequence, apply: Callable[[Any, Any], Any] | None = None,
+            prepare: Callable[[Any], Any] | None = None, label: str = '', chunk_size: int = DEFAULT_CHUNK_SIZE,
+            frame_budget: float = DEFAULT_FRAME_BUDGET, parent: QObject | None = None):
+        """
+        Initializes task.
+
+        :param items: items to process.
+        :param apply: optional function called in the main thread for each item. It receives the item and its
+            prepared value (None if no prepare function is given).
+        :param prepare: optional pure compute function called in a worker thread for each item.
+        :param label: task label shown in progress widgets.
+        :param chunk_size: number of items processed per chunk.
+        :param frame_budget: maximum time in seconds spent applying items before giving control back to the UI.
+        :param parent: optional parent object.
+        """
+
+        super().__init__(parent)
+
+        if apply is None and prepare is None:
+            raise ValueError('Task needs at least an apply or a prepare function')
+
+        self._items = list(items)
+        self._apply = apply
+        self._prepare = prepare
+        self._label = label
+        self._chunk_size = max(1, chunk_size)
+        self._frame_budget = frame_budget
+        self._cancel_event = threading.Event()
+        self._done = 0
+        self._running = False
+        self._error: BaseException | None = None
+
+    @property
+    def label(self) -> str:
+        """
+        Returns task label.
+
+        :return: task label.
+        """
+
+        return self._label
+
+    @property
+    def error(self) -> BaseException | None:
+        """
+        Returns the exception raised by the task functions during the last run.
+
+        :return: raised exception or None if task did not fail.
+        """
+
+        return self._error
+
+    @property
+    def total(self) -> int:
+        """
+        Returns the number of items to process.
+
+        :return: total number of items.
+        """
+
+        return len(self._items)
+
+    @property
+    def done(self) -> int:
+        """
+        Returns the number of processed items.
+
+        :return: number of processed items.
+        """
+
+        return self._done
+
+    def is_running(self) -> bool:
+        """
+        Returns whether task is running.
+
+        :return: True if task is running; False otherwise.
+        """
+
+        return self._running
+
+    def is_cancelled(self) -> bool:
+        """
+        Returns whether task was cancelled.
+
+        :return: True if task was cancelled; False otherwise.
+        """
+
+        return self._cancel_event.is_set()
+
+    def cancel(self):
+        """
+        Requests task cancellation. It is safe to call it from any thread.
+        """
+
+        self._cancel_event.set()
+
+    def check_cancelled(self):
+        """
+        Raises TaskCancelled if task was cancelled. Can be called from task functions.
+
+        :raises TaskCancelled: if task was cancelled.
+        """
+
+        if self._cancel_event.is_set():
+            raise TaskCancelled(self._label)
+
+    def set_message(self, message: str):
+        """
+        Sets the message shown in progress widgets.
+
+        :param message: progress message.
+        """
+
+        self.messageChanged.emit(message)
+
+    async def run(self) -> list:
+        """
+        Runs the task in the current asyncio event loop.
+
+        :return: list with the value returned by apply for each item (or the prepared value if no apply function is
+            given).
+        :raises TaskCancelled: if task was cancelled.
+        """
+
+        if self._running:
+            raise RuntimeError(f'Task "{self._label}" is already running')
+
+        self._running = True
+        self._done = 0
+        self._error = None
+        succeeded = False
+        loop = asyncio.get_running_loop()
+        chunks = [self._items[i:i + self._chunk_size] for i in range(0, len(self._items), self._chunk_size)]
+        pending: collections.deque[asyncio.Future] = collections.deque()
+        results: list = []
+        self.progressChanged.emit(0, self.total)
+        try:
+            next_chunk = 0
+            deadline = time.perf_counter() + self._frame_budget
+            for chunk in chunks:
+                # keep worker pool busy preparing the next chunks while this one is applied.
+                if self._prepare is not None:
+                    while next_chunk < len(chunks) and len(pending) < MAX_WORKERS * 2:
+                        pending.append(loop.run_in_executor(executor(), self._prepare_chunk, chunks[next_chunk]))
+                        next_chunk += 1
+                    prepared = await pending.popleft()
+                else:
+                    prepared = [None] * len(chunk)
+                self.check_cancelled()
+
+                for item, value in zip(chunk, prepared):
+                    self.check_cancelled()
+                    results.append(self._apply(item, value) if self._apply is not None else value)
+                    self._done += 1
+                    if time.perf_counter() >= deadline:
+                        self.progressChanged.emit(self._done, self.total)
+                        # give control back to Qt, so UI and viewport are refreshed.
+                        await asyncio.sleep(0)
+                        deadline = time.perf_counter() + self._frame_budget
+            succeeded = True
+        except TaskCancelled:
+            raise
+        except Exception as exc:
+            self._error = exc
+            raise
+        finally:
+            if not succeeded:
+                self.cancel()
+            for future in pending:
+                future.cancel()
+            self._running = False
+            self.progressChanged.emit(self._done, self.total)
+            self.finished.emit(succeeded)
+
+        return results
+
+    def _prepare_chunk(self, chunk: list) -> list:
+        """
+        Internal function that prepares given chunk items. It runs in a worker thread.
+
+        :param chunk: items to prepare.
+        :return: prepared values.
+        """
+
+        prepared = []
+        for item in chunk:
+            if self._cancel_event.is_set():
+                break
+            prepared.append(self._prepare(item))
+
+        return prepared
+
+
+def executor() -> ThreadPoolExecutor:
+    """
+    Returns the shared worker thread pool used to prepare task chunks.
+    Threads are used (instead of processes) because DCC interpreters cannot spawn Python worker processes reliably,
+    so only prepare functions that release the GIL are prepared in parallel.
+
+    :return: thread pool executor.
+    """
+
+    global _EXECUTOR
+
+    if _EXECUTOR is None:
+        _EXECUTOR = ThreadPoolExecutor(max_workers=MAX_WORKERS, thread_name_prefix='tp-task')
+
+    return _EXECUTOR
@@ -1,17 +1,20 @@
 from __future__ import annotations
 
 import sys
+import itertools
+import asyncio
 import logging
 import traceback
-from typing import Iterator, Type, Any
+from typing import Iterator, Type, Any, Coroutine
 from dataclasses import dataclass, field
 
 from ..externals.Qt.QtCore import Signal, QObject
 from ..externals.Qt.QtWidgets import QWidget, QLineEdit, QCheckBox,  QStackedWidget
 from ..dcc import callback
 from ..python import helpers, decorators, plugin
-from ..qt import utils as qtutils
-from ..qt.widgets import frameless, comboboxes, groups, lineedits, search
+from ..qt import refresh, asyncloop, query
+from ..qt.widgets import frameless, frames, comboboxes, groups, lineedits, search, progress
+from . import task
 
 logger = logging.getLogger(__name__)
 logger.setLevel(logging.INFO)
@@ -137,8 +140,10 @@ class Tool(QObject):
         self._properties: helpers.ObjectDict[str, UiProperty] = self.setup_properties()
         self._listeners: dict[str, callable] = {}
         self._stacked_widget: QStackedWidget | None = None
+        self._progress_widget: progress.TaskProgressWidget | None = None
         self._show_warnings: bool = True
         self._block_save: bool = False
+        self._pending_property_updates: set[str] = set()
         self._closed = False
         self._callbacks = callback.FnCallback()
 
@@ -245,6 +250,8 @@ class Tool(QObject):
         win.set_title(self.ui_data.label)
         self._stacked_widget = QStackedWidget(parent=win)
         win.main_layout().addWidget(self._stacked_widget)
+        self._progress_widget = progress.TaskProgressWidget(parent=win)
+        win.main_layout().addWidget(self._progress_widget)
 
         self.pre_content_setup()
 
@@ -258,9 +265,11 @@ class Tool(QObject):
         self.post_content_setup()
         self.update_widgets_from_properties()
         self.save_properties()
+        self._connect_lazy_frames(self._stacked_widget)
 
         win.show()
         win.closed.connect(self._run_teardown)
+        win.beginClosing.connect(self._on_window_begin_closing)
 
         return win
 
@@ -322,9 +331,12 @@ class Tool(QObject):
 
         return tool_properties
 
-    def auto_link_properties(self):
+    def auto_link_properties(self, root: QWidget | None = None):
         """
         Auto link UI properties to widgets if allowed.
+
+        :param root: optional widget whose children are linked. If not given, all tool widgets are linked. If given,
+            already existing properties keep their values (e.g: when lazy contents of a frame are built again).
         """
 
         if not self.ui_data.auto_link_properties:
@@ -333,11 +345,13 @@ class Tool(QObject):
         new_properties: list[UiProperty] = []
         names: list[str] = []
 
-        for name, widget in self.iterate_linkable_properties(self._stacked_widget):
+        for name, widget in self.iterate_linkable_properties(root or self._stacked_widget):
             skip_children = SUPPORT_WIDGET_TYPES.get(type(widget)).skip_children
             widget.setProperty('skipChildren', skip_children)
             if not self.link_property(widget, name):
                 continue
+            if root is not None and name in self.properties:
+                continue
             if name not in names:
                 new_property = UiProperty(name)
                 widget_values = self.widget_values(widget)
@@ -346,6 +360,20 @@ class Tool(QObject):
                 new_properties.append(new_property)
                 names.append(name)
 
+        # widgets built from compiled UI specs are already bound to their properties.
+        for widget in self.property_widgets(root):
+            name = self.widget_property_name(widget)
+            widget_info = SUPPORT_WIDGET_TYPES.get(type(widget))
+            if widget_info is not None and widget.property('skipChildren') is None:
+                widget.setProperty('skipChildren', widget_info.skip_children)
+            if name in names or name in self.properties or widget_info is None:
+                continue
+            new_property = UiProperty(name)
+            for k, v in self.widget_values(widget).items():
+                setattr(new_property, k, v)
+            new_properties.append(new_property)
+            names.append(name)
+
         new_props = self.setup_properties(new_properties)
         self.properties.update(new_props)
 
@@ -380,24 +408,23 @@ class Tool(QObject):
         :return: An iterator of tuples, each containing the name of a linkable property and the widget.
         """
 
-        for attr in widget.__dict__:
-            if type(getattr(widget, attr)) in SUPPORT_WIDGET_TYPES:
-                yield attr, getattr(widget, attr)
-
-        children = widget.children()
-        for child in children:
-            for attr in child.__dict__:
-                if type(getattr(child, attr)) in SUPPORT_WIDGET_TYPES:
-                    yield attr, getattr(child, attr)
-            for grandchild in self.iterate_linkable_properties(child):
-                yield grandchild
+        for obj in itertools.chain((widget,), query.iterate_descendants(widget)):
+            for attr in obj.__dict__:
+                if type(getattr(obj, attr)) in SUPPORT_WIDGET_TYPES:
+                    yield attr, getattr(obj, attr)
 
-    def populate_widgets(self):
+    def populate_widgets(self, root: QWidget | None = None):
         """
         Makes the connection for all widgets linked to UI properties.
+
+        :param root: optional widget whose children are connected. If not given, all tool widgets are connected.
         """
 
-        property_widgets = self.property_widgets()
+        # property names are set on leaf widgets, which are not watched by the widgets index.
+        query.invalidate(self._stacked_widget)
+        if root is not None:
+            query.invalidate(root)
+        property_widgets = self.property_widgets(root)
         for widget in property_widgets:
             modified = False
             widget_type = type(widget)
@@ -411,21 +438,17 @@ class Tool(QObject):
             if not modified and self._show_warnings:
                 logger.warning(f'Unsupported widget: {widget}. Property: {widget_name}')
 
-    def property_widgets(self) -> list[QWidget]:
+    def property_widgets(self, root: QWidget | None = None) -> list[QWidget]:
         """
         Returns a list of property widgets associated with the instance.
 
         This method returns a list of property widgets associated with the instance.
 
+        :param root: optional widget to look for property widgets in. If not given, all tool widgets are checked.
         :return: A list of property widgets.
         """
 
-        found_widgets: list[QWidget] = []
-        for child in qtutils.iterate_children(self._stacked_widget, skip='skipChildren'):
-            if child.property('prop') is not None:
-                found_widgets.append(child)
-
-        return found_widgets
+        return query.query(root or self._stacked_widget, prop='prop', skip='skipChildren')
 
     def widgets_linked_to_property(self, property_name: str) -> list[QWidget]:
         """
@@ -437,14 +460,7 @@ class Tool(QObject):
         :return: A list of widgets linked to the specified property.
         """
 
-        found_widgets: list[QWidget] = []
-        for child in qtutils.iterate_children(self._stacked_widget, skip='skipChildren'):
-            child_property = child.property('prop')
-            if child_property is None or child_property != property_name:
-                continue
-            found_widgets.append(child)
-
-        return found_widgets
+        return query.query(self._stacked_widget, prop='prop', value=property_name, skip='skipChildren')
 
     def update_widget(self, widget: QWidget):
         """
@@ -476,33 +492,54 @@ class Tool(QObject):
         """
         Updates the widget associated with the specified UI property.
 
-        This method updates the widget associated with the specified UI property.
+        Update is deferred to the refresh scheduler, so updating several properties (or the same property several
+        times) within the same event loop iteration only walks the tool widgets and updates them once.
 
         :param ui_property_name: The name of the UI property to update the widget for.
         """
 
-        self._stacked_widget.setUpdatesEnabled(False)
-        self._block_save = True
+        if self._stacked_widget is None:
+            return
 
-        property_widgets = self.widgets_linked_to_property(ui_property_name)
-        for widget in property_widgets:
-            self.update_widget(widget)
-        for widget in property_widgets:
-            widget.blockSignals(False)
+        self._pending_property_updates.add(ui_property_name)
+        refresh.refresh_scheduler().refresh(self._stacked_widget, self._flush_property_updates)
 
-        self._block_save = False
-        self._stacked_widget.setUpdatesEnabled(True)
+    def _flush_property_updates(self):
+        """
+        Internal function that updates the widgets linked to the properties whose update was requested.
+        """
+
+        property_names, self._pending_property_updates = self._pending_property_updates, set()
+        if not property_names:
+            return
 
-    def update_widgets_from_properties(self):
+        self._block_save = True
+        try:
+            property_widgets = [
+                child for child in query.query(self._stacked_widget, prop='prop', skip='skipChildren')
+                if child.property('prop') in property_names]
+            for widget in property_widgets:
+                self.update_widget(widget)
+            for widget in property_widgets:
+                widget.blockSignals(False)
+        except RuntimeError:
+            # tool widgets were already deleted.
+            pass
+        finally:
+            self._block_save = False
+
+    def update_widgets_from_properties(self, root: QWidget | None = None):
         """
         Updates all widgets to current linked property internal value.
+
+        :param root: optional widget whose children are updated. If not given, all tool widgets are updated.
         """
 
         # self.block_callbacks(True)
         self._block_save = True
         self._stacked_widget.setUpdatesEnabled(False)
 
-        property_widgets = self.property_widgets()
+        property_widgets = self.property_widgets(root)
         for widget in property_widgets:
             self.update_widget(widget)
         for widget in property_widgets:
@@ -552,6 +589,10 @@ class Tool(QObject):
         if self._block_save:
             return
 
+        # widgets must show the values of the updated properties before being saved, otherwise pending property
+        # updates would be reverted with the old widget values.
+        self._flush_property_updates()
+
         property_widgets = self.property_widgets()
         for widget in property_widgets:
             property_name = self.widget_property_name(widget)
@@ -634,6 +675,57 @@ class Tool(QObject):
 
         pass
 
+    def create_task(self, coro: Coroutine, name: str | None = None) -> asyncio.Task:
+        """
+        Schedules given coroutine to run on the Qt asyncio event loop, so tool I/O (e.g: database queries or file
+        scans) does not block the UI. Task is cancelled when the tool window closes.
+
+        :param coro: coroutine to run.
+        :param name: optional task name.
+        :return: scheduled task.
+        """
+
+        return asyncloop.create_task(coro, owner=self, name=name)
+
+    def run_task(self, chunked_task: task.ChunkedTask) -> asyncio.Task:
+        """
+        Runs given chunked task without blocking the UI. Task progress is shown in the tool window and the user can
+        cancel it. Task is cancelled when the tool window closes.
+
+        :param chunked_task: task to run.
+        :return: scheduled asyncio task. Its result is the list of task results or None if task was cancelled or
+            failed.
+        """
+
+        if self._progress_widget is not None:
+            self._progress_widget.set_task(chunked_task)
+
+        return self.create_task(self._run_chunked_task(chunked_task), name=chunked_task.label or None)
+
+    async def _run_chunked_task(self, chunked_task: task.ChunkedTask) -> list | None:
+        """
+        Internal function that runs given chunked task, handling its cancellation and its errors. Errors are logged
+        and shown in the tool window progress widget.
+
+        :param chunked_task: task to run.
+        :return: task results or None if task was cancelled or failed.
+        """
+
+        try:
+            return await chunked_task.run()
+        except task.TaskCancelled:
+            logger.info(f'Task "{chunked_task.label}" was cancelled ({chunked_task.done}/{chunked_task.total})')
+            return None
+        except Exception as exc:
+            logger.exception(f'Task "{chunked_task.label}" failed ({chunked_task.done}/{chunked_task.total})')
+            if self._progress_widget is not None:
+                try:
+                    self._progress_widget.show_error(f'{chunked_task.label or "Task"} failed: {exc}')
+                except RuntimeError:
+                    # tool window was already deleted.
+                    pass
+            return None
+
     def _execute(self, *args, **kwargs) -> Tool:
         """
         Internal function that executes tool in a safe way.
@@ -654,6 +746,35 @@ class Tool(QObject):
 
         return self
 
+    def _connect_lazy_frames(self, root: QWidget):
+        """
+        Internal function that connects the collapsible frames with lazy contents found within given widget, so
+        widgets are linked to tool properties each time frame contents are built.
+
+        :param root: widget to look for collapsible frames in.
+        """
+
+        for frame in root.findChildren(frames.CollapsibleFrame):
+            if frame.property('lazyContentLinked'):
+                continue
+            frame.setProperty('lazyContentLinked', True)
+            frame.contentBuilt.connect(lambda f=frame: self._on_lazy_content_built(f))
+            frame.contentAboutToBeReleased.connect(lambda f=frame: self._on_lazy_content_about_to_be_released(f))
+
+    def _on_lazy_content_about_to_be_released(self, frame: frames.CollapsibleFrame):
+        """
+        Internal callback function that is called before the lazy contents of a collapsible frame are deleted.
+        Tool attributes that reference released widgets are set to None, so they are not used once deleted.
+
+        :param frame: collapsible frame whose contents are going to be released.
+        """
+
+        content_widget = frame.hider_layout.parentWidget()
+        released = {id(widget) for widget in content_widget.findChildren(QWidget)} if content_widget else set()
+        for attr, value in list(vars(self).items()):
+            if isinstance(value, QWidget) and id(value) in released:
+                setattr(self, attr, None)
+
     def _run_teardown(self):
         """
         Internal function that tries to tear down the tool in a safe way.
@@ -663,8 +784,33 @@ class Tool(QObject):
             logger.warning(f'Tool f"{self}" already closed')
             return
 
+        asyncloop.cancel_tasks(self)
+        self._flush_property_updates()
         try:
             self.teardown()
             self._closed = True
         except RuntimeError:
             logger.error(f'Failed to teardown tool: {self.id}', exc_info=True)
+
+    def _on_window_begin_closing(self):
+        """
+        Internal callback function that is called when tool window starts closing.
+        Pending tool tasks are cancelled.
+        """
+
+        asyncloop.cancel_tasks(self)
+        self._flush_property_updates()
+
+    def _on_lazy_content_built(self, frame: frames.CollapsibleFrame):
+        """
+        Internal callback function that is called each time lazy contents of a collapsible frame are built.
+        New widgets are linked to tool properties and updated with their current values.
+
+        :param frame: collapsible frame whose contents were built.
+        """
+
+        self.auto_link_properties(frame)
+        self.populate_widgets(frame)
+        self.update_widgets_from_properties(frame)
+        self._connect_lazy_frames(frame)
+        refresh.refresh_scheduler().relayout(frame)
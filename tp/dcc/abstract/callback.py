@@ -18,6 +18,9 @@ class Callback(enum.IntEnum):
     SelectionChanged = 2
     Undo = 3
     Redo = 4
+    NodeAdded = 5
+    NodeRemoved = 6
+    NodeRenamed = 7
 
 
 class AFnCallback(base.AFnBase):
@@ -31,11 +34,14 @@ class AFnCallback(base.AFnBase):
     __slots__ = ('_callbacks', '__weakref__')
 
     __callbacks__ = {
-        Callback.PreFileOpen: 'addPreFileOpenCallback',
-        Callback.PostFileOpen: 'addPostFileOpenCallback',
-        Callback.SelectionChanged: 'addSelectionChangedCallback',
-        Callback.Undo: 'addUndoCallback',
-        Callback.Redo: 'addRedoCallback',
+        Callback.PreFileOpen: 'add_pre_file_open_callback',
+        Callback.PostFileOpen: 'add_post_file_open_callback',
+        Callback.SelectionChanged: 'add_selection_changed_callback',
+        Callback.Undo: 'add_undo_callback',
+        Callback.Redo: 'add_redo_callback',
+        Callback.NodeAdded: 'add_node_added_callback',
+        Callback.NodeRemoved: 'add_node_removed_callback',
+        Callback.NodeRenamed: 'add_node_renamed_callback',
     }
 
     def __init__(self, *args, **kwargs):
@@ -54,21 +60,25 @@ class AFnCallback(base.AFnBase):
 
         self.clear()
 
-    def add_callback(self, callback_type: Callback, func: callable):
+    def add_callback(self, callback_type: Callback, func: callable) -> list[Any]:
         """
         Adds a new callback using the given callback type.
 
         :param Callback callback_type: callback type to add.
         :param callable func: callback function.
+        :return: IDs of the registered DCC callbacks, that can be used to remove them with `remove_callback_ids`.
         """
 
         func_name = self.__callbacks__.get(callback_type, '')
         delegate = getattr(self, func_name, None)
-        if callable(delegate):
-            return delegate(func)
-        else:
+        if not callable(delegate):
             raise TypeError(f'add_callback() expects a valid callback ({callback_type} given)!')
 
+        registered_count = len(self._callbacks[callback_type])
+        delegate(func)
+
+        return list(self._callbacks[callback_type])[registered_count:]
+
     def remove_callback(self, callback_type: Callback):
         """
         Removes the given callback from the scene.
@@ -78,6 +88,19 @@ class AFnCallback(base.AFnBase):
 
         self._callbacks[callback_type].clear()
 
+    def remove_callback_ids(self, callback_type: Callback, callback_ids: list[Any]):
+        """
+        Removes only the given DCC callbacks of the given type, leaving the ones registered by other owners.
+
+        :param Callback callback_type: type of the callbacks to remove.
+        :param list[Any] callback_ids: IDs of the callbacks to remove, as returned by `add_callback`.
+        """
+
+        callbacks = self._callbacks[callback_type]
+        for callback_id in callback_ids:
+            if callback_id in callbacks:
+                callbacks.remove(callback_id)
+
     def register_callback(self, callback_type: Callback, callback_id: Any):
         """
         Registers a new callback within the internal callbacks trackers.
@@ -149,6 +172,36 @@ class AFnCallback(base.AFnBase):
 
         pass
 
+    @abc.abstractmethod
+    def add_node_added_callback(self, func: callable):
+        """
+        Adds callback that is called each time a new DAG node is added into the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def add_node_removed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is removed from the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def add_node_renamed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is renamed.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        pass
+
     def clear(self):
         """
         Removes all callbacks.
@@ -35,6 +35,12 @@ class FnCallback(callback.AFnCallback):
         if pymxs.runtime.isKindOf(callback_id, pymxs.runtime.Name):
             logger.info(f'Removing callback: {callback_id}')
             pymxs.runtime.callbacks.removeScripts(id=callback_id)
+        elif pymxs.runtime.isKindOf(callback_id, pymxs.runtime.NodeEventCallback):
+            # node event callbacks are only released once they are no longer referenced and garbage collected, so
+            # they are disabled right away.
+            logger.info(f'Removing node event callback: {callback_id}')
+            callback_id.enabled = False
+            pymxs.runtime.gc(light=True)
 
     def add_pre_file_open_callback(self, func: callable):
         """
@@ -90,6 +96,36 @@ class FnCallback(callback.AFnCallback):
         pymxs.runtime.callbacks.addScript(pymxs.runtime.Name('sceneRedo'), func, id=callback_id, persistent=False)
         self.register_callback(self.Callback.Redo, callback_id)
 
+    def add_node_added_callback(self, func: callable):
+        """
+        Adds callback that is called each time a new DAG node is added into the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        callback_id = pymxs.runtime.nodeEventCallback(added=func)
+        self.register_callback(self.Callback.NodeAdded, callback_id)
+
+    def add_node_removed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is removed from the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        callback_id = pymxs.runtime.nodeEventCallback(deleted=func)
+        self.register_callback(self.Callback.NodeRemoved, callback_id)
+
+    def add_node_renamed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is renamed.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        callback_id = pymxs.runtime.nodeEventCallback(nameChanged=func)
+        self.register_callback(self.Callback.NodeRenamed, callback_id)
+
     def clear(self):
         """
         Removes all callbacks.
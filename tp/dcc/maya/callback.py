@@ -83,3 +83,34 @@ class FnCallback(callback.AFnCallback):
 
         callback_id = OpenMaya.MEventMessage.addEventCallback('Redo', func)
         self.register_callback(self.Callback.Redo, callback_id)
+
+    def add_node_added_callback(self, func: callable):
+        """
+        Adds callback that is called each time a new DAG node is added into the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        callback_id = OpenMaya.MDGMessage.addNodeAddedCallback(func, 'dagNode')
+        self.register_callback(self.Callback.NodeAdded, callback_id)
+
+    def add_node_removed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is removed from the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        callback_id = OpenMaya.MDGMessage.addNodeRemovedCallback(func, 'dagNode')
+        self.register_callback(self.Callback.NodeRemoved, callback_id)
+
+    def add_node_renamed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is renamed.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        # a null node makes Maya notify name changes of all nodes.
+        callback_id = OpenMaya.MNodeMessage.addNameChangedCallback(OpenMaya.MObject(), func)
+        self.register_callback(self.Callback.NodeRenamed, callback_id)
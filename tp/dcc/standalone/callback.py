@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 import logging
+from uuid import uuid4
 from typing import Any
 
 from ..abstract import callback
@@ -14,6 +15,21 @@ formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(messag
 handler.setFormatter(formatter)
 logger.addHandler(handler)
 
+# standalone has no scene notifications, so callbacks are stored here and called by `notify`.
+_CALLBACKS: dict[callback.Callback, dict[str, callable]] = {}
+
+
+def notify(callback_type: callback.Callback, *args):
+    """
+    Calls all the standalone callbacks registered for the given callback type.
+
+    :param callback_type: type of the callbacks to call.
+    :param args: arguments to pass to the callbacks.
+    """
+
+    for func in list(_CALLBACKS.get(callback_type, {}).values()):
+        func(*args)
+
 
 class FnCallback(callback.AFnCallback):
     """
@@ -29,7 +45,8 @@ class FnCallback(callback.AFnCallback):
         :param Any callback_id: ID of the callback to remove.
         """
 
-        pass
+        for callbacks in _CALLBACKS.values():
+            callbacks.pop(callback_id, None)
 
     def add_pre_file_open_callback(self, func: callable):
         """
@@ -75,3 +92,42 @@ class FnCallback(callback.AFnCallback):
         """
 
         pass
+
+    def add_node_added_callback(self, func: callable):
+        """
+        Adds callback that is called each time a new DAG node is added into the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        self._add_standalone_callback(self.Callback.NodeAdded, func)
+
+    def add_node_removed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is removed from the scene.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        self._add_standalone_callback(self.Callback.NodeRemoved, func)
+
+    def add_node_renamed_callback(self, func: callable):
+        """
+        Adds callback that is called each time a DAG node is renamed.
+
+        :param callable func: callback function. It receives the DCC specific callback arguments.
+        """
+
+        self._add_standalone_callback(self.Callback.NodeRenamed, func)
+
+    def _add_standalone_callback(self, callback_type: callback.Callback, func: callable):
+        """
+        Internal function that stores given function, so it is called when given callback type is notified.
+
+        :param callback_type: callback type.
+        :param callable func: callback function.
+        """
+
+        callback_id = uuid4().hex
+        _CALLBACKS.setdefault(callback_type, {})[callback_id] = func
+        self.register_callback(callback_type, callback_id)
@@ -0,0 +1,440 @@
+from __future__ import annotations
+
+import time
+from typing import Hashable, Iterable
+
+SCORE_MATCH = 16
+SCORE_GAP_START = -3
+SCORE_GAP_EXTENSION = -1
+BONUS_BOUNDARY = 8
+BONUS_NON_WORD = 8
+BONUS_CAMEL_CASE = 7
+BONUS_CONSECUTIVE = -(SCORE_GAP_START + SCORE_GAP_EXTENSION)
+BONUS_FIRST_CHAR_MULTIPLIER = 2
+
+_CHAR_NON_WORD = 0
+_CHAR_LOWER = 1
+_CHAR_UPPER = 2
+_CHAR_NUMBER = 3
+
+
+def _char_class(char: str) -> int:
+    """
+    Internal function that returns the class of the given character.
+
+    :param char: character to get class of.
+    :return: character class.
+    """
+
+    if char.islower():
+        return _CHAR_LOWER
+    elif char.isupper():
+        return _CHAR_UPPER
+    elif char.isdigit():
+        return _CHAR_NUMBER
+
+    return _CHAR_NON_WORD
+
+
+def _bonus(previous_class: int, current_class: int) -> int:
+    """
+    Internal function that returns the bonus of matching a character based on its class and the class of the
+    previous character.
+
+    :param previous_class: class of the previous character.
+    :param current_class: class of the matched character.
+    :return: bonus score.
+    """
+
+    if previous_class == _CHAR_NON_WORD and current_class != _CHAR_NON_WORD:
+        return BONUS_BOUNDARY
+    elif (previous_class == _CHAR_LOWER and current_class == _CHAR_UPPER) or (
+            previous_class != _CHAR_NUMBER and current_class == _CHAR_NUMBER):
+        return BONUS_CAMEL_CASE
+    elif current_class == _CHAR_NON_WORD:
+        return BONUS_NON_WORD
+
+    return 0
+
+
+def fuzzy_score(pattern: str, text: str, lowered_text: str | None = None) -> int | None:
+    """
+    Returns the score of matching given pattern as a subsequence of the given text.
+
+    Scoring follows fzf: matched characters at word boundaries, camel case humps and consecutive matches score higher
+    while gaps between matched characters are penalized. Shortest matching window is used.
+
+    :param pattern: lowercase pattern to match.
+    :param text: text to match pattern against.
+    :param lowered_text: optional lowercase version of the text, to avoid lowering it again.
+    :return: match score or None if pattern is not a subsequence of the text.
+    """
+
+    if not pattern:
+        return 0
+
+    lowered_text = text.lower() if lowered_text is None else lowered_text
+
+    # forward pass: find the end of the first occurrence of the pattern as a subsequence.
+    index = -1
+    start = -1
+    for char in pattern:
+        index = lowered_text.find(char, index + 1)
+        if index < 0:
+            return None
+        if start < 0:
+            start = index
+    end = index + 1
+
+    # backward pass: shrink the window from the end, so the shortest match is scored.
+    index = end
+    for char in reversed(pattern):
+        index = lowered_text.rfind(char, start, index)
+    start = index
+
+    score = 0
+    pattern_index = 0
+    in_gap = False
+    consecutive = 0
+    first_bonus = 0
+    previous_class = _char_class(text[start - 1]) if start > 0 else _CHAR_NON_WORD
+    for i in range(start, end):
+        current_class = _char_class(text[i])
+        if pattern_index < len(pattern) and lowered_text[i] == pattern[pattern_index]:
+            score += SCORE_MATCH
+            bonus = _bonus(previous_class, current_class)
+            if consecutive == 0:
+                first_bonus = bonus
+            else:
+                if bonus == BONUS_BOUNDARY:
+                    first_bonus = bonus
+                bonus = max(bonus, first_bonus, BONUS_CONSECUTIVE)
+            score += bonus * BONUS_FIRST_CHAR_MULTIPLIER if pattern_index == 0 else bonus
+            in_gap = False
+            consecutive += 1
+            pattern_index += 1
+        else:
+            score += SCORE_GAP_EXTENSION if in_gap else SCORE_GAP_START
+            in_gap = True
+            consecutive = 0
+            first_bonus = 0
+        previous_class = current_class
+
+    return score
+
+
+class FuzzyIndex:
+    """
+    Class that indexes texts by key, so they can be searched using fuzzy matching.
+
+    Two inverted indexes are kept: one of characters, used to discard the keys whose texts cannot contain the searched
+    pattern as a subsequence, and one of n-grams, used to score first the keys whose texts contain the pattern as a
+    substring. Both indexes are updated incrementally when keys are added, updated or removed.
+    """
+
+    def __init__(self, ngram_size: int = 3):
+        super().__init__()
+
+        self._ngram_size = ngram_size
+        self._texts: dict[Hashable, tuple[str, ...]] = {}
+        self._lowered_texts: dict[Hashable, tuple[str, ...]] = {}
+        self._chars: dict[str, set[Hashable]] = {}
+        self._ngrams: dict[str, set[Hashable]] = {}
+
+    def __len__(self) -> int:
+        return len(self._texts)
+
+    def __contains__(self, key: Hashable) -> bool:
+        return key in self._texts
+
+    def keys(self) -> list[Hashable]:
+        """
+        Returns all indexed keys, in insertion order.
+
+        :return: indexed keys.
+        """
+
+        return list(self._texts.keys())
+
+    def texts(self, key: Hashable) -> tuple[str, ...]:
+        """
+        Returns the texts indexed for given key.
+
+        :param key: indexed key.
+        :return: indexed texts.
+        """
+
+        return self._texts.get(key, ())
+
+    def lowered_texts(self, key: Hashable) -> tuple[str, ...] | None:
+        """
+        Returns the lowercase texts indexed for given key.
+
+        :param key: indexed key.
+        :return: lowercase indexed texts or None if key is not indexed.
+        """
+
+        return self._lowered_texts.get(key)
+
+    def add(self, key: Hashable, texts: Iterable[str]):
+        """
+        Indexes given texts with the given key. If key is already indexed, its texts are replaced.
+
+        :param key: key to index texts with (e.g: an action or a row).
+        :param texts: texts to index.
+        """
+
+        if key in self._texts:
+            self.remove(key)
+
+        texts = tuple(str(text) for text in texts if text)
+        lowered_texts = tuple(text.lower() for text in texts)
+        self._texts[key] = texts
+        self._lowered_texts[key] = lowered_texts
+        for lowered_text in lowered_texts:
+            for char in set(lowered_text):
+                self._chars.setdefault(char, set()).add(key)
+            for ngram in self._text_ngrams(lowered_text):
+                self._ngrams.setdefault(ngram, set()).add(key)
+
+    update = add
+
+    def remove(self, key: Hashable):
+        """
+        Removes given key from the index.
+
+        :param key: key to remove.
+        """
+
+        lowered_texts = self._lowered_texts.pop(key, None)
+        self._texts.pop(key, None)
+        if lowered_texts is None:
+            return
+
+        for lowered_text in lowered_texts:
+            for char in set(lowered_text):
+                keys = self._chars.get(char)
+                if keys is not None:
+                    keys.discard(key)
+                    if not keys:
+                        del self._chars[char]
+            for ngram in self._text_ngrams(lowered_text):
+                keys = self._ngrams.get(ngram)
+                if keys is not None:
+                    keys.discard(key)
+                    if not keys:
+                        del self._ngrams[ngram]
+
+    def clear(self):
+        """
+        Removes all keys from the index.
+        """
+
+        self._texts.clear()
+        self._lowered_texts.clear()
+        self._chars.clear()
+        self._ngrams.clear()
+
+    def candidates(self, token: str) -> tuple[set[Hashable], set[Hashable]]:
+        """
+        Returns the keys whose texts can match the given token.
+
+        :param token: lowercase search token.
+        :return: tuple containing the keys containing all token characters and the keys containing all token n-grams
+            (which are very likely to contain token as a substring).
+        """
+
+        char_sets = sorted((self._chars.get(char, set()) for char in set(token)), key=len)
+        candidates = set(char_sets[0]).intersection(*char_sets[1:]) if char_sets else set(self._texts.keys())
+        ngrams = self._text_ngrams(token)
+        if not ngrams:
+            return candidates, set()
+        ngram_sets = sorted((self._ngrams.get(ngram, set()) for ngram in ngrams), key=len)
+        substring_candidates = set(ngram_sets[0]).intersection(*ngram_sets[1:])
+
+        return candidates, substring_candidates
+
+    def search(self, query: str, match_all: bool = True, limit: int | None = None) -> list[tuple[Hashable, int]]:
+        """
+        Searches the index synchronously.
+
+        :param query: search query. Space separated tokens are matched independently.
+        :param match_all: whether all query tokens must match or just any of them.
+        :param limit: optional maximum number of results.
+        :return: list of (key, score) tuples sorted from best to worst match.
+        """
+
+        job = FuzzySearchJob(self, query, match_all=match_all)
+        job.run()
+
+        return job.results(limit)
+
+    def _text_ngrams(self, lowered_text: str) -> set[str]:
+        """
+        Internal function that returns the n-grams of the given text.
+
+        :param lowered_text: lowercase text.
+        :return: text n-grams.
+        """
+
+        size = self._ngram_size
+        return {lowered_text[i:i + size] for i in range(len(lowered_text) - size + 1)}
+
+
+class FuzzySearchJob:
+    """
+    Class that scores the candidates of a fuzzy search query. Scoring can be done in steps with a time budget, so
+    big indexes can be searched without blocking the UI, and it can be cancelled when the query becomes stale.
+    """
+
+    def __init__(self, index: FuzzyIndex, query: str, match_all: bool = True):
+        super().__init__()
+
+        self._index = index
+        self._query = query
+        self._tokens = str(query or '').lower().split()
+        self._match_all = match_all
+        self._cancelled = False
+        self._scores: dict[Hashable, int] = {}
+        self._keys: list[Hashable] = self._collect_candidates()
+        self._position = 0
+
+    @property
+    def query(self) -> str:
+        """
+        Returns search query.
+
+        :return: search query.
+        """
+
+        return self._query
+
+    @property
+    def cancelled(self) -> bool:
+        """
+        Returns whether job was cancelled.
+
+        :return: True if job was cancelled; False otherwise.
+        """
+
+        return self._cancelled
+
+    def is_done(self) -> bool:
+        """
+        Returns whether all candidates were scored.
+
+        :return: True if job finished; False otherwise.
+        """
+
+        return self._cancelled or self._position >= len(self._keys)
+
+    def cancel(self):
+        """
+        Cancels the job.
+        """
+
+        self._cancelled = True
+
+    def step(self, budget: float | None = None, chunk_size: int = 256) -> bool:
+        """
+        Scores candidates until given time budget is consumed.
+
+        :param budget: time budget in seconds. If None, all candidates are scored.
+        :param chunk_size: number of candidates scored between time budget checks.
+        :return: True if job finished; False otherwise.
+        """
+
+        deadline = time.perf_counter() + budget if budget is not None else None
+        while not self.is_done():
+            self._score_chunk(chunk_size)
+            if deadline is not None and time.perf_counter() >= deadline:
+                break
+
+        return self.is_done()
+
+    def run(self):
+        """
+        Scores all candidates.
+        """
+
+        self.step()
+
+    def results(self, limit: int | None = None) -> list[tuple[Hashable, int]]:
+        """
+        Returns the scored keys found so far.
+
+        :param limit: optional maximum number of results.
+        :return: list of (key, score) tuples sorted from best to worst match.
+        """
+
+        results = sorted(self._scores.items(), key=lambda item: (-item[1], min(map(len, self._index.texts(item[0])),
+                                                                                  default=0)))
+        return results[:limit] if limit is not None else results
+
+    def matched_keys(self) -> set[Hashable]:
+        """
+        Returns the keys matched so far.
+
+        :return: matched keys.
+        """
+
+        return set(self._scores.keys())
+
+    def _collect_candidates(self) -> list[Hashable]:
+        """
+        Internal function that returns the keys to score, with the most promising ones first.
+
+        :return: candidate keys.
+        """
+
+        if not self._tokens:
+            return self._index.keys()
+
+        candidates: set[Hashable] | None = None
+        substring_candidates: set[Hashable] = set()
+        for token in self._tokens:
+            token_candidates, token_substring_candidates = self._index.candidates(token)
+            substring_candidates |= token_substring_candidates
+            if candidates is None:
+                candidates = token_candidates
+            elif self._match_all:
+                candidates &= token_candidates
+            else:
+                candidates |= token_candidates
+        candidates = candidates or set()
+
+        return [key for key in substring_candidates if key in candidates] + [
+            key for key in candidates if key not in substring_candidates]
+
+    def _score_chunk(self, chunk_size: int):
+        """
+        Internal function that scores the next chunk of candidates.
+
+        :param chunk_size: number of candidates to score.
+        """
+
+        end = min(self._position + chunk_size, len(self._keys))
+        for key in self._keys[self._position:end]:
+            lowered_texts = self._index.lowered_texts(key)
+            if lowered_texts is None:
+                continue
+            if not self._tokens:
+                self._scores[key] = 0
+                continue
+            texts = self._index.texts(key)
+            total_score = 0
+            matched = False
+            for token in self._tokens:
+                scores = [
+                    score for score in (fuzzy_score(token, text, lowered) for text, lowered in zip(texts, lowered_texts))
+                    if score is not None]
+                if not scores:
+                    if self._match_all:
+                        matched = False
+                        break
+                    continue
+                matched = True
+                total_score += max(scores)
+            if matched:
+                self._scores[key] = total_score
+        self._position = end
@@ -51,14 +51,11 @@ def canonical_path(path: str, ignore_members: list[str] | None = None) -> str:
         ignore_members = [ignore_members]
     ignore_members.append('canonical_path')
 
-    # get the current frame and inspect the stack and loop through the inspect stack and break when not a function
-    # to ignore.
-    frame = inspect.currentframe()
-    inspect_stack = inspect.stack()[1:]
-
-    for (frame, filename, lineno, function, context, index) in inspect_stack:
-        if function not in ignore_members:
-            break
+    # walk the stack frames and break when not a function to ignore. Frames are walked manually because
+    # inspect.stack() reads and formats the source context of every frame, which is really slow.
+    frame = inspect.currentframe().f_back
+    while frame.f_back is not None and frame.f_code.co_name in ignore_members:
+        frame = frame.f_back
 
     base_path = os.path.dirname(inspect.getfile(frame))
     full_path = os.path.join(base_path, normalized(path))
@@ -271,6 +271,53 @@ class PluginFactory:
 
         return re.compile(r'([a-zA-Z_].*)(\.py$)')
 
+    @classmethod
+    def candidate_files(cls, path: str) -> list[str]:
+        """
+        Returns the files that are inspected searching for plugins when given path is registered.
+
+        :param path: absolute folder or file path.
+        :return: list of absolute file paths.
+        """
+
+        file_paths: list[str] = []
+        if os.path.isdir(path):
+            folder_validator = cls.get_regex_folder_validator()
+            file_validator = cls.get_regex_file_validator()
+            for root, _, files in folder.walk_level(path):
+                if not folder_validator.match(root):
+                    continue
+                for file_name in files:
+                    # Skip files that do not match PluginFactory regex validator.
+                    if not file_validator.match(file_name):
+                        continue
+                    if file_name.startswith('test') or file_name in ['setup.py']:
+                        continue
+                    file_paths.append(pathlib.Path(root, file_name).as_posix())
+        elif os.path.isfile(path):
+            file_paths.append(path)
+
+        return file_paths
+
+    @classmethod
+    def plugin_module(cls, file_path: str, mechanism: int = PluginLoadingMechanism.GUESS) -> ModuleType | None:
+        """
+        Imports or loads the module defined in given file, using the given plugin load mechanism.
+
+        :param file_path: absolute module file path.
+        :param mechanism: plugin load mechanism to use.
+        :return: module or None if module could not be imported nor loaded.
+        """
+
+        module = None
+        if mechanism in (cls.PluginLoadingMechanism.IMPORTABLE, cls.PluginLoadingMechanism.GUESS):
+            module = cls._mechanism_import(file_path)
+        if not module:
+            if mechanism in (cls.PluginLoadingMechanism.LOAD_SOURCE, cls.PluginLoadingMechanism.GUESS):
+                module = cls._mechanism_load(file_path)
+
+        return module
+
     @property
     def loaded_plugins(self) -> dict[str, list[Any]]:
         """
@@ -307,33 +354,9 @@ class PluginFactory:
 
         current_plugins_count = len(self._plugins)
 
-        file_paths = list()
-        if os.path.isdir(path_to_register):
-            for root, _, files in folder.walk_level(path_to_register):
-                if not self.get_regex_folder_validator().match(root):
-                    continue
-                for file_name in files:
-                    # Skip files that do not match PluginFactory regex validator.
-                    if not self.get_regex_file_validator().match(file_name):
-                        continue
-                    if file_name.startswith('test') or file_name in ['setup.py']:
-                        continue
-                    file_paths.append(pathlib.Path(root, file_name).as_posix())
-        elif os.path.isfile(path_to_register):
-            file_paths.append(path_to_register)
-
         # Loop through all the found files searching for plugins definitions
-        for file_path in file_paths:
-            module_to_inspect = None
-            if mechanism in (self.PluginLoadingMechanism.IMPORTABLE, self.PluginLoadingMechanism.GUESS):
-                module_to_inspect = self._mechanism_import(file_path)
-                # if module_to_inspect:
-                #     logger.debug('Module Import : {}'.format(file_path))
-            if not module_to_inspect:
-                if mechanism in (self.PluginLoadingMechanism.LOAD_SOURCE, self.PluginLoadingMechanism.GUESS):
-                    module_to_inspect = self._mechanism_load(file_path)
-                    # if module_to_inspect:
-                    #     logger.debug('Direct Load : {}'.format(file_path))
+        for file_path in self.candidate_files(path_to_register):
+            module_to_inspect = self.plugin_module(file_path, mechanism=mechanism)
             if not module_to_inspect:
                 continue
 
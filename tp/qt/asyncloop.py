@@ -0,0 +1,444 @@
+from __future__ import annotations
+
+import sys
+import math
+import asyncio
+import logging
+import weakref
+import functools
+import selectors
+import threading
+from typing import Any, Callable, Coroutine
+
+from ..externals.Qt.QtCore import Qt, QObject, Signal, QTimer, QSocketNotifier
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+_EVENT_LOOP: QtEventLoop | None = None
+_OWNED_TASKS: weakref.WeakKeyDictionary[QObject, set[asyncio.Task]] = weakref.WeakKeyDictionary()
+
+
+class _NonBlockingSelector(selectors.BaseSelector):
+    """
+    Selector that never blocks: asyncio loop iterations are driven by the Qt event loop, so waiting for I/O is done by
+    Qt (through a socket notifier or a poll timer) instead of by the selector.
+    """
+
+    def __init__(self, selector: selectors.BaseSelector | None = None):
+        super().__init__()
+
+        self._selector = selector or selectors.DefaultSelector()
+
+    def register(self, fileobj, events, data=None) -> selectors.SelectorKey:
+        return self._selector.register(fileobj, events, data)
+
+    def unregister(self, fileobj) -> selectors.SelectorKey:
+        return self._selector.unregister(fileobj)
+
+    def modify(self, fileobj, events, data=None) -> selectors.SelectorKey:
+        return self._selector.modify(fileobj, events, data)
+
+    # noinspection PyUnusedLocal
+    def select(self, timeout: float | None = None) -> list[tuple[selectors.SelectorKey, int]]:
+        return self._selector.select(0)
+
+    def close(self):
+        self._selector.close()
+
+    def get_key(self, fileobj) -> selectors.SelectorKey:
+        return self._selector.get_key(fileobj)
+
+    def get_map(self):
+        return self._selector.get_map()
+
+    def fileno(self) -> int | None:
+        """
+        Returns the file descriptor of the wrapped selector. It becomes readable when any registered file is ready.
+
+        :return: selector file descriptor or None if wrapped selector has no file descriptor (e.g: select on Windows).
+        """
+
+        fileno = getattr(self._selector, 'fileno', None)
+        return fileno() if fileno is not None else None
+
+
+class _QtLoopDriver(QObject):
+    """
+    Class that runs asyncio event loop iterations from the Qt event loop.
+    """
+
+    wakeUpRequested = Signal()
+
+    def __init__(self, step: Callable[[], None]):
+        super().__init__()
+
+        self._step = step
+        self._notifier: QSocketNotifier | None = None
+        self._timer = QTimer(parent=self)
+        self._timer.setSingleShot(True)
+        self._timer.timeout.connect(self._step)
+        # queued, so wake-up requests done from other threads or from within a loop iteration never run it re-entrant.
+        self.wakeUpRequested.connect(self._on_wake_up_requested, Qt.QueuedConnection)
+
+    def schedule(self, timeout: int | None):
+        """
+        Schedules the next loop iteration.
+
+        :param timeout: time in milliseconds to wait for before running the next iteration. If None, next iteration
+            only runs when the Qt socket notifier, a wake-up request or a new scheduled callback requests it.
+        """
+
+        if timeout is None:
+            self._timer.stop()
+        elif not self._timer.isActive() or self._timer.remainingTime() > timeout:
+            self._timer.start(timeout)
+
+    def watch(self, fileno: int | None):
+        """
+        Runs a loop iteration each time given file descriptor becomes readable.
+
+        :param fileno: file descriptor to watch. If None, file descriptor watching is stopped.
+        """
+
+        if self._notifier is not None:
+            self._notifier.setEnabled(False)
+            self._notifier.deleteLater()
+            self._notifier = None
+        if fileno is not None:
+            self._notifier = QSocketNotifier(fileno, QSocketNotifier.Read, self)
+            self._notifier.activated.connect(self._step)
+
+    def is_watching(self) -> bool:
+        """
+        Returns whether a file descriptor is watched.
+
+        :return: True if file descriptor is watched; False otherwise.
+        """
+
+        return self._notifier is not None
+
+    def stop(self):
+        """
+        Stops running loop iterations.
+        """
+
+        self._timer.stop()
+        self.watch(None)
+
+    def _on_wake_up_requested(self):
+        """
+        Internal callback function that is called when a loop iteration is requested.
+        """
+
+        self.schedule(0)
+
+
+class QtEventLoop(asyncio.SelectorEventLoop):
+    """
+    Class that implements an asyncio event loop that runs on top of the Qt event loop, so coroutines can be used from
+    both standalone applications and DCC-hosted tools without blocking the UI and without running a second loop.
+
+    Loop never blocks: each iteration only processes ready callbacks and ready I/O. Next iteration is scheduled through
+    a Qt timer (for timed callbacks) and a Qt socket notifier (for I/O readiness). On platforms whose selector has no
+    file descriptor (e.g: Windows), I/O is polled while there are registered files.
+
+    Once attached, the loop is reported as running, so `run_forever` and `run_until_complete` cannot be used. Tasks
+    are created with `create_task` and they run while Qt processes events.
+    """
+
+    POLL_INTERVAL = 10
+
+    def __init__(self):
+        self._attached = False
+        self._driver = _QtLoopDriver(self._step)
+
+        super().__init__(selector=_NonBlockingSelector())
+
+    def is_attached(self) -> bool:
+        """
+        Returns whether loop is attached to the Qt event loop.
+
+        :return: True if loop is attached; False otherwise.
+        """
+
+        return self._attached
+
+    def attach(self):
+        """
+        Attaches this loop to the Qt event loop of the current thread.
+        """
+
+        if self._attached:
+            return
+
+        self._check_closed()
+        self._check_running()
+        self._thread_id = threading.get_ident()
+        self._attached = True
+        self._driver.watch(self._selector.fileno())
+        self._schedule_step()
+
+    def detach(self):
+        """
+        Detaches this loop from the Qt event loop. Pending callbacks are kept and run once the loop is attached again.
+        """
+
+        if not self._attached:
+            return
+
+        self._driver.stop()
+        self._attached = False
+        self._stopping = False
+        self._thread_id = None
+
+    def close(self):
+        """
+        Overrides base close function to detach the loop before closing it.
+        """
+
+        self.detach()
+        super().close()
+
+    def stop(self):
+        """
+        Overrides base stop function. Loop is detached from the Qt event loop after the current iteration.
+        """
+
+        super().stop()
+        self._schedule_step()
+
+    def call_soon(self, callback, *args, context=None) -> asyncio.Handle:
+        """
+        Overrides base call_soon function to schedule a loop iteration.
+        """
+
+        handle = super().call_soon(callback, *args, context=context)
+        if self._attached:
+            self._driver.schedule(0)
+
+        return handle
+
+    def call_at(self, when, callback, *args, context=None) -> asyncio.TimerHandle:
+        """
+        Overrides base call_at function to schedule a loop iteration when the callback is due.
+        """
+
+        handle = super().call_at(when, callback, *args, context=context)
+        if self._attached:
+            self._driver.schedule(self._timeout_to(when))
+
+        return handle
+
+    def _add_reader(self, fd, callback, *args):
+        handle = super()._add_reader(fd, callback, *args)
+        self._schedule_step()
+        return handle
+
+    def _add_writer(self, fd, callback, *args):
+        handle = super()._add_writer(fd, callback, *args)
+        self._schedule_step()
+        return handle
+
+    def _write_to_self(self):
+        """
+        Overrides base _write_to_self function, called by `call_soon_threadsafe`, to request a loop iteration from
+        the Qt event loop.
+        """
+
+        super()._write_to_self()
+        if self._attached:
+            self._driver.wakeUpRequested.emit()
+
+    def _timeout_to(self, when: float) -> int:
+        """
+        Internal function that returns the time in milliseconds left until given loop time.
+
+        :param when: loop time.
+        :return: milliseconds left.
+        """
+
+        return max(0, math.ceil((when - self.time()) * 1000))
+
+    def _schedule_step(self):
+        """
+        Internal function that schedules next loop iteration based on the pending callbacks and registered files.
+        """
+
+        if not self._attached:
+            return
+
+        if self._ready or self._stopping:
+            timeout = 0
+        elif self._scheduled:
+            timeout = self._timeout_to(self._scheduled[0].when())
+        else:
+            timeout = None
+
+        # Self-pipe is always registered, so only poll when other files are registered too.
+        if not self._driver.is_watching() and len(self._selector.get_map()) > 1:
+            timeout = self.POLL_INTERVAL if timeout is None else min(timeout, self.POLL_INTERVAL)
+
+        self._driver.schedule(timeout)
+
+    def _step(self):
+        """
+        Internal function that runs a single loop iteration.
+        """
+
+        if not self._attached or self.is_closed():
+            return
+
+        # another loop is running in this thread (e.g: asyncio.run called from a Qt callback), run later.
+        running_loop = asyncio.events._get_running_loop()
+        if running_loop is not None and running_loop is not self:
+            self._driver.schedule(self.POLL_INTERVAL)
+            return
+
+        old_agen_hooks = sys.get_asyncgen_hooks()
+        sys.set_asyncgen_hooks(firstiter=self._asyncgen_firstiter_hook, finalizer=self._asyncgen_finalizer_hook)
+        asyncio.events._set_running_loop(self)
+        try:
+            self._run_once()
+        except Exception:
+            logger.exception('Error while running asyncio loop iteration')
+        finally:
+            asyncio.events._set_running_loop(running_loop)
+            sys.set_asyncgen_hooks(*old_agen_hooks)
+
+        if self._stopping:
+            self.detach()
+            return
+
+        self._schedule_step()
+
+
+def event_loop() -> QtEventLoop:
+    """
+    Returns global asyncio event loop that runs on top of the Qt event loop. Loop is attached on first access.
+
+    :return: Qt asyncio event loop.
+    """
+
+    global _EVENT_LOOP
+
+    if _EVENT_LOOP is None or _EVENT_LOOP.is_closed():
+        _EVENT_LOOP = QtEventLoop()
+        _EVENT_LOOP.attach()
+
+    return _EVENT_LOOP
+
+
+def create_task(
+        coro: Coroutine, owner: QObject | None = None, name: str | None = None) -> asyncio.Task:
+    """
+    Schedules given coroutine to run on the Qt asyncio event loop.
+
+    :param coro: coroutine to run.
+    :param owner: optional Qt object that owns the task. Task is cancelled when owner is destroyed or when
+        `cancel_tasks` is called with that owner.
+    :param name: optional task name.
+    :return: scheduled task.
+    """
+
+    task = event_loop().create_task(coro, name=name)
+    if owner is None:
+        return task
+
+    tasks = _OWNED_TASKS.get(owner)
+    if tasks is None:
+        tasks = _OWNED_TASKS[owner] = set()
+        owner.destroyed.connect(functools.partial(_cancel_all, tasks))
+    tasks.add(task)
+    task.add_done_callback(tasks.discard)
+
+    return task
+
+
+def cancel_tasks(owner: QObject) -> int:
+    """
+    Cancels all the pending tasks owned by given object.
+
+    :param owner: tasks owner.
+    :return: number of cancelled tasks.
+    """
+
+    tasks = _OWNED_TASKS.get(owner)
+    return _cancel_all(tasks) if tasks else 0
+
+
+def owned_tasks(owner: QObject) -> list[asyncio.Task]:
+    """
+    Returns the pending tasks owned by given object.
+
+    :param owner: tasks owner.
+    :return: list of pending tasks.
+    """
+
+    return [task for task in _OWNED_TASKS.get(owner, ()) if not task.done()]
+
+
+def slot(func: Callable[..., Coroutine]) -> Callable[..., asyncio.Task]:
+    """
+    Decorator that allows coroutine functions to be connected to Qt signals. Each call schedules a new task. If the
+    decorated function is a method of a Qt object, that object owns the task.
+
+    :param func: coroutine function to decorate.
+    :return: decorated function.
+    """
+
+    @functools.wraps(func)
+    def _wrapper(*args, **kwargs) -> asyncio.Task:
+        owner = args[0] if args and isinstance(args[0], QObject) else None
+        return create_task(func(*args, **kwargs), owner=owner, name=func.__qualname__)
+
+    return _wrapper
+
+
+async def wait_signal(signal: Signal, timeout: float | None = None) -> Any:
+    """
+    Waits until given Qt signal is emitted.
+
+    :param signal: bound Qt signal to wait for (e.g: button.clicked).
+    :param timeout: optional maximum time in seconds to wait for.
+    :return: signal arguments: None if signal has no arguments, the argument if it has one or a tuple otherwise.
+    :raises asyncio.TimeoutError: if signal is not emitted within the given timeout.
+    """
+
+    future = asyncio.get_running_loop().create_future()
+
+    def _on_emitted(*args):
+        if not future.done():
+            future.set_result(None if not args else args[0] if len(args) == 1 else args)
+
+    signal.connect(_on_emitted)
+    try:
+        return await (asyncio.wait_for(future, timeout) if timeout is not None else future)
+    finally:
+        try:
+            signal.disconnect(_on_emitted)
+        except (RuntimeError, TypeError):
+            # signal owner was already deleted.
+            pass
+
+
+def _cancel_all(tasks: set[asyncio.Task], *args) -> int:
+    """
+    Internal function that cancels given tasks.
+
+    :param tasks: tasks to cancel.
+    :return: number of cancelled tasks.
+    """
+
+    cancelled = 0
+    for task in list(tasks):
+        if task.cancel():
+            cancelled += 1
+
+    return cancelled
@@ -1,10 +1,11 @@
 from __future__ import annotations
 
+import weakref
 import platform
-from typing import Tuple, Iterable
+from typing import Tuple, Iterable, Any
 
-from ..externals.Qt.QtCore import QPoint, QSize
-from ..externals.Qt.QtWidgets import QApplication
+from ..externals.Qt.QtCore import QObject, QEvent, QPoint, QSize
+from ..externals.Qt.QtWidgets import QApplication, QWidget
 
 
 if platform.system().lower() == 'windows':
@@ -19,6 +20,10 @@ else:
 UI_SCALE = 1.0
 SCALE_FACTORS = (0.7, 0.8, 0.9, 1.0, 1.25, 1.5, 1.75, 2.0, 2.5, 3.0)
 
+# DPI multipliers are cached per screen and invalidated when screen logical DPI changes or when screen is removed.
+_SCREEN_MULTIPLIERS: dict[Any, float] = {}
+_SCREEN_TRACKER: ScreenTracker | None = None
+
 
 def init_ui_scale(value: int | float | None = None):
     """
@@ -32,6 +37,7 @@ def init_ui_scale(value: int | float | None = None):
     value = ui_scale_value(value)
 
     UI_SCALE = value
+    invalidate_dpi_cache()
 
 
 def ui_scale_value(value: int | float | None = None) -> float:
@@ -62,28 +68,72 @@ def ui_scale_value(value: int | float | None = None) -> float:
     return value
 
 
-def dpi_multiplier() -> float:
+def widget_screen(widget: QWidget | None = None):
     """
-    Returns current application DPI multiplier.
+    Returns the screen given widget is displayed in.
 
-    :return: DPI multiplier value
+    :param widget: widget to get screen of. If not given, primary screen is returned.
+    :return: screen instance.
     """
 
-    desktop = QApplication.primaryScreen()
-    logical_y = desktop.logicalDotsPerInchY() if desktop is not None else DPI
+    if widget is not None:
+        if hasattr(widget, 'screen'):
+            # QWidget.screen is only available since Qt 5.14.
+            return widget.screen()
+        window_handle = widget.window().windowHandle()
+        if window_handle is not None:
+            return window_handle.screen()
+
+    return QApplication.primaryScreen()
 
-    return max(1, int(float(logical_y) / float(DPI))) * float(UI_SCALE)
 
+def dpi_multiplier(widget: QWidget | None = None) -> float:
+    """
+    Returns DPI multiplier of the screen the given widget is displayed in.
 
-def dpi_scale(value: int | float) -> int | float:
+    :param widget: optional widget to get DPI multiplier for. If not given, primary screen DPI multiplier is returned.
+    :return: DPI multiplier value.
+    ..note:: multiplier is cached per screen, so screen is only queried once until its logical DPI changes.
+    """
+
+    screen = widget_screen(widget)
+    multiplier = _SCREEN_MULTIPLIERS.get(screen)
+    if multiplier is not None:
+        return multiplier
+
+    logical_y = screen.logicalDotsPerInchY() if screen is not None else DPI
+    multiplier = max(1, int(float(logical_y) / float(DPI))) * float(UI_SCALE)
+    if screen is not None:
+        _SCREEN_MULTIPLIERS[screen] = multiplier
+        screen_tracker().track_screen(screen)
+
+    return multiplier
+
+
+def invalidate_dpi_cache(screen: Any | None = None):
+    """
+    Invalidates cached DPI multipliers.
+
+    :param screen: optional screen to invalidate cached DPI multiplier of. If not given, all cached multipliers are
+        invalidated.
+    """
+
+    if screen is None:
+        _SCREEN_MULTIPLIERS.clear()
+    else:
+        _SCREEN_MULTIPLIERS.pop(screen, None)
+
+
+def dpi_scale(value: int | float, widget: QWidget | None = None) -> int | float:
     """
     Resizes by value based on current DPI.
 
     :param value: value default 2k size in pixels/
+    :param widget: optional widget whose screen DPI is used. If not given, primary screen DPI is used.
     :return: size in pixels now DPI monitor is (4k, 2k, ...).
     """
 
-    return value * dpi_multiplier()
+    return value * dpi_multiplier(widget)
 
 
 def dpi_scale_divide(value: int) -> float:
@@ -143,29 +193,188 @@ def size_by_dpi(size: QSize) -> QSize:
     return QSize(dpi_scale(size.width()), dpi_scale(size.height()))
 
 
+class ScreenTracker(QObject):
+    """
+    Class that invalidates cached DPI multipliers when screens change and that notifies DPI scaled widgets when they
+    are moved to another screen.
+    """
+
+    def __init__(self):
+        super().__init__()
+
+        self._screens: weakref.WeakSet = weakref.WeakSet()
+        self._windows: weakref.WeakSet = weakref.WeakSet()
+        self._widgets: weakref.WeakSet[DPIScaling] = weakref.WeakSet()
+        self._pending: weakref.WeakSet[QWidget] = weakref.WeakSet()
+
+        app = QApplication.instance()
+        if app is not None:
+            app.screenRemoved.connect(invalidate_dpi_cache)
+
+    def track_screen(self, screen):
+        """
+        Invalidates screen cached DPI multiplier when its logical DPI changes.
+
+        :param QScreen screen: screen to track.
+        """
+
+        if screen in self._screens:
+            return
+
+        self._screens.add(screen)
+        screen.logicalDotsPerInchChanged.connect(lambda *_: invalidate_dpi_cache(screen))
+
+    def track_widget(self, widget: DPIScaling):
+        """
+        Registers given widget, so its DPI scaled sizes are applied again when its window changes of screen.
+
+        Only top-level windows are watched: the screen changed signal of each native window is connected once. If the
+        window is not created yet, a temporary event filter is installed on the top-level widget until it is shown.
+
+        :param widget: DPI scaled widget.
+        """
+
+        if widget in self._widgets:
+            return
+
+        self._widgets.add(widget)
+        if not self._track_window(widget):
+            top_level = widget.window()
+            if top_level not in self._pending:
+                self._pending.add(top_level)
+                top_level.installEventFilter(self)
+
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        if event.type() == QEvent.Show and self._track_window(watched):
+            # native window exists now, so its screen changed signal is used instead.
+            watched.removeEventFilter(self)
+            self._pending.discard(watched)
+        return False
+
+    def _track_window(self, widget: QWidget) -> bool:
+        """
+        Internal function that connects the screen changed signal of the native window of the given widget.
+
+        :param widget: widget whose window should be tracked.
+        :return: True if the native window of the widget is tracked; False if it is not created yet.
+        """
+
+        window_handle = widget.window().windowHandle()
+        if window_handle is None:
+            return False
+        if window_handle in self._windows:
+            return True
+
+        self._windows.add(window_handle)
+        window_handle.screenChanged.connect(lambda *_: self._on_window_screen_changed(window_handle))
+
+        return True
+
+    def _on_window_screen_changed(self, window_handle):
+        """
+        Internal callback function that is called each time a tracked window changes of screen.
+
+        :param QWindow window_handle: window whose screen changed.
+        """
+
+        for widget in list(self._widgets):
+            try:
+                if widget.window().windowHandle() is window_handle:
+                    widget.apply_dpi_sizes()
+            except RuntimeError:
+                # Qt object was already deleted.
+                self._widgets.discard(widget)
+
+
+def screen_tracker() -> ScreenTracker:
+    """
+    Returns global screen tracker instance.
+
+    :return: screen tracker.
+    """
+
+    global _SCREEN_TRACKER
+
+    if _SCREEN_TRACKER is None:
+        _SCREEN_TRACKER = ScreenTracker()
+
+    return _SCREEN_TRACKER
+
+
 # noinspection PyPep8Naming,PyUnresolvedReferences
 class DPIScaling:
     """
-    Mixin class that can be used in any QWidget to add DPI scaling functionality to it
+    Mixin class that can be used in any QWidget to add DPI scaling functionality to it.
+    Sizes are scaled using the DPI of the screen the widget is in and are applied again when widget window moves to
+    a screen with a different DPI.
     """
 
     def setFixedSize(self, size):
-        return super(DPIScaling, self).setFixedSize(dpi_scale(size))
+        return self._set_dpi_size('setFixedSize', size)
 
     def setFixedHeight(self, height):
-        return super(DPIScaling, self).setFixedHeight(dpi_scale(height))
+        return self._set_dpi_size('setFixedHeight', height)
 
     def setFixedWidth(self, width):
-        return super(DPIScaling, self).setFixedWidth(dpi_scale(width))
+        return self._set_dpi_size('setFixedWidth', width)
 
     def setMaximumWidth(self, width):
-        return super(DPIScaling, self).setMaximumWidth(dpi_scale(width))
+        return self._set_dpi_size('setMaximumWidth', width)
 
     def setMinimumWidth(self, width):
-        return super(DPIScaling, self).setMinimumWidth(dpi_scale(width))
+        return self._set_dpi_size('setMinimumWidth', width)
 
     def setMaximumHeight(self, height):
-        return super(DPIScaling, self).setMaximumHeight(dpi_scale(height))
+        return self._set_dpi_size('setMaximumHeight', height)
 
     def setMinimumHeight(self, height):
-        return super(DPIScaling, self).setMinimumHeight(dpi_scale(height))
+        return self._set_dpi_size('setMinimumHeight', height)
+
+    def apply_dpi_sizes(self):
+        """
+        Applies again all DPI scaled sizes using the DPI of the screen the widget is in.
+        """
+
+        dpi_sizes = self.__dict__.get('_dpi_sizes', {})
+        base = super(DPIScaling, self)
+        for dimension in ('Width', 'Height'):
+            minimum = dpi_sizes.get(f'minimum{dimension}')
+            maximum = dpi_sizes.get(f'maximum{dimension}')
+            if minimum is not None and minimum == maximum:
+                getattr(base, f'setFixed{dimension}')(dpi_scale(minimum, self))
+                continue
+            if minimum is not None:
+                getattr(base, f'setMinimum{dimension}')(dpi_scale(minimum, self))
+            if maximum is not None:
+                getattr(base, f'setMaximum{dimension}')(dpi_scale(maximum, self))
+
+    def _set_dpi_size(self, setter_name: str, value: Any):
+        """
+        Internal function that stores given unscaled size and applies it scaled by widget screen DPI.
+        Only the last size set for each bound (minimum/maximum width/height) is stored, so sizes applied again when
+        screen DPI changes are the current ones, no matter the order setters were called in.
+
+        :param setter_name: name of the QWidget size setter.
+        :param value: unscaled size.
+        """
+
+        dpi_sizes = self.__dict__.get('_dpi_sizes')
+        if dpi_sizes is None:
+            dpi_sizes = self.__dict__['_dpi_sizes'] = {}
+            screen_tracker().track_widget(self)
+        if setter_name == 'setFixedSize':
+            width, height = (value.width(), value.height()) if hasattr(value, 'width') else (value, value)
+            dpi_sizes.update(minimumWidth=width, maximumWidth=width, minimumHeight=height, maximumHeight=height)
+        elif setter_name.startswith('setFixed'):
+            dimension = setter_name[len('setFixed'):]
+            dpi_sizes[f'minimum{dimension}'] = dpi_sizes[f'maximum{dimension}'] = value
+        else:
+            bound = setter_name[3].lower() + setter_name[4:]
+            dpi_sizes[bound] = value
+            # same as Qt, setting a minimum bigger than the maximum (or vice versa) also updates the other bound.
+            dimension = bound[len('minimum'):]
+            minimum, maximum = dpi_sizes.get(f'minimum{dimension}'), dpi_sizes.get(f'maximum{dimension}')
+            if minimum is not None and maximum is not None and minimum > maximum:
+                dpi_sizes[f'maximum{dimension}' if bound.startswith('minimum') else f'minimum{dimension}'] = value
+
+        return getattr(super(DPIScaling, self), setter_name)(dpi_scale(value, self))
@@ -1,13 +1,21 @@
 from __future__ import annotations
 
+import copy
+import inspect
 import logging
-from typing import Sequence, Any
+from typing import Sequence, Callable, Any
+from dataclasses import dataclass, field
 
 from ..externals.Qt.QtCore import Qt, QSize
-from ..externals.Qt.QtWidgets import QWidget, QComboBox, QLineEdit, QTextBrowser, QPushButton, QCheckBox
+from ..externals.Qt.QtWidgets import (
+    QWidget, QComboBox, QLineEdit, QTextBrowser, QPushButton, QCheckBox, QLayout, QGridLayout
+)
 from ..externals.Qt.QtGui import QIcon
 
 from . import uiconsts, dpi, icon
+from .. import resources
+from ..python import helpers
+from ..resources.style import theme
 from .widgets.layouts import VerticalLayout, HorizontalLayout, GridLayout
 from .widgets.labels import BaseLabel, ClippedLabel, IconLabel
 from .widgets.comboboxes import BaseComboBox, NoWheelComboBox
@@ -458,6 +466,8 @@ def base_button(
     if checkable:
         new_button.setCheckable(True)
         new_button.setChecked(checked)
+    if icon_color_theme and theme_updates:
+        theme.instance().register_widget(new_button, [icon_color_theme])
 
     return new_button
 
@@ -580,6 +590,8 @@ def shadowed_button(
         new_button.setMaximumWidth(max_width)
     if min_width is not None:
         new_button.setMinimumWidth(min_width)
+    if icon_color_theme and theme_updates:
+        theme.instance().register_widget(new_button, [icon_color_theme])
 
     return new_button
 
@@ -603,6 +615,7 @@ def tool_button(
         new_tool_button.image(button_icon)
     if tooltip:
         new_tool_button.setToolTip(tooltip)
+    theme.instance().register_widget(new_tool_button, ['primary_color'])
 
     return new_tool_button
 
@@ -771,3 +784,284 @@ def checkbox_widget(
     return BaseCheckBoxWidget(
         text=text, checked=checked, tooltip=tooltip, enable_menu=enable_menu, label_ratio=label_ratio,
         box_ratio=box_ratio, right=right, parent=parent)
+
+
+@dataclass
+class UiSpec:
+    """
+    A data class that declares a widget or a layout (and its children) to be built by the factory.
+
+    Attributes
+    ----------
+    type : str
+        Name of the factory function used to build the widget or layout (e.g: label, line_edit, vertical_layout).
+        The special type "stretch" adds a stretch to the parent box layout.
+    kwargs : dict[str, Any]
+        Keyword arguments passed to the factory function. Icon arguments can be given by their resource name.
+    name : str
+        Optional name the built widget or layout is stored with within the built UI.
+    prop : str
+        Optional name of the tool UI property the widget is linked to.
+    children : list[UiSpec]
+        Children specs. Only layouts can have children.
+    stretch : int
+        Stretch factor used when adding the widget to its parent box layout.
+    cell : tuple[int, ...]
+        Row and column (and optionally row and column spans) used when adding the widget to its parent grid layout.
+    sizes : dict[str, int]
+        Sizes, in pixels before DPI scaling, set once the widget is built (e.g: {'min_width': 100}). Valid keys are
+        min_width, max_width, min_height, max_height, fixed_width and fixed_height.
+    properties : dict[str, Any]
+        Dynamic properties (e.g: used by style sheets) set once the widget or layout is built.
+    """
+
+    type: str
+    kwargs: dict[str, Any] = field(default_factory=dict)
+    name: str = ''
+    prop: str = ''
+    children: list[UiSpec] = field(default_factory=list)
+    stretch: int = 0
+    cell: tuple[int, ...] = ()
+    sizes: dict[str, int] = field(default_factory=dict)
+    properties: dict[str, Any] = field(default_factory=dict)
+
+    @classmethod
+    def from_dict(cls, data: dict | UiSpec) -> UiSpec:
+        """
+        Creates a new spec instance from given dictionary.
+
+        :param data: spec dictionary. Its children can also be dictionaries.
+        :return: new spec instance.
+        """
+
+        if isinstance(data, UiSpec):
+            return data
+
+        data = dict(data)
+        data['children'] = [cls.from_dict(child) for child in data.get('children', [])]
+        data['cell'] = tuple(data.get('cell', ()))
+
+        return cls(**data)
+
+
+@dataclass
+class UiPlanStep:
+    """
+    A data class that stores a single construction step of a compiled UI plan.
+
+    Attributes
+    ----------
+    builder : Callable | None
+        Factory function that builds the widget or layout. None for stretch steps.
+    kwargs : dict[str, Any]
+        Validated keyword arguments, with icons already resolved.
+    parent_index : int
+        Index of the step of the parent layout. -1 for the root step.
+    is_layout : bool
+        Whether step builds a layout.
+    name : str
+        Name the built object is stored with.
+    prop : str
+        Name of the tool UI property the widget is linked to.
+    stretch : int
+        Stretch factor within parent box layout.
+    cell : tuple[int, ...]
+        Cell within parent grid layout.
+    sizes : tuple[tuple[Callable, int], ...]
+        Validated size setters and their sizes, in pixels before DPI scaling.
+    properties : tuple[tuple[str, Any], ...]
+        Dynamic properties to set, including the tool UI property name.
+    """
+
+    builder: Callable | None
+    kwargs: dict[str, Any]
+    parent_index: int
+    is_layout: bool
+    name: str = ''
+    prop: str = ''
+    stretch: int = 0
+    cell: tuple[int, ...] = ()
+    sizes: tuple[tuple[Callable, int], ...] = ()
+    properties: tuple[tuple[str, Any], ...] = ()
+
+
+class UiPlan:
+    """
+    Class that stores the construction steps of a compiled UI spec. Spec validation, icons resolution, DPI scaling of
+    sizes and dynamic properties resolution only happen once, when the plan is compiled, so the same UI can be built
+    many times cheaply (e.g: per item editors). Sizes are scaled again only if the DPI multiplier changes.
+    """
+
+    def __init__(self, steps: list[UiPlanStep]):
+        super().__init__()
+
+        self._steps = steps
+        self._dpi_multiplier: float | None = None
+        self._scaled_sizes: list[tuple[int, Callable, int]] = []
+        self._properties = [
+            (i, name, value) for i, step in enumerate(steps) for name, value in step.properties]
+        self._resolve_sizes()
+
+    @property
+    def steps(self) -> list[UiPlanStep]:
+        """
+        Returns plan construction steps.
+
+        :return: construction steps.
+        """
+
+        return self._steps
+
+    def build(self, parent: QWidget | None = None) -> helpers.ObjectDict:
+        """
+        Builds the UI.
+
+        Widgets and layouts are built and added to their parent layout one step at a time. Then, precomputed sizes and
+        dynamic properties are applied in a single pass, before the root is parented, so layouts are not activated
+        and widgets are not polished for each one of them. Updates of the parent widget are disabled while building,
+        so it is only repainted once, when all the steps are done. Mutable keyword arguments (e.g: combo box items)
+        are copied, so widgets built by different builds do not share them.
+
+        :param parent: optional parent widget. If given and the root of the plan is a layout, layout is set as the
+            parent widget layout.
+        :return: dictionary containing the root widget or layout (within the "root" key) and all the named widgets
+            and layouts.
+        """
+
+        if dpi.dpi_multiplier() != self._dpi_multiplier:
+            self._resolve_sizes()
+
+        built: list[QWidget | QLayout | None] = []
+        result = helpers.ObjectDict()
+        updates_enabled = parent.updatesEnabled() if parent is not None else True
+        if parent is not None:
+            parent.setUpdatesEnabled(False)
+        try:
+            for step in self._steps:
+                built_object = step.builder(**self._copy_kwargs(step.kwargs)) if step.builder is not None else None
+                built.append(built_object)
+                if step.name:
+                    result[step.name] = built_object
+                if step.parent_index >= 0:
+                    self._add_to_layout(built[step.parent_index], built_object, step)
+            for step_index, setter, size in self._scaled_sizes:
+                setter(built[step_index], size)
+            # skipChildren is set by the tool, depending on the widget type, when properties are linked.
+            for step_index, property_name, value in self._properties:
+                built[step_index].setProperty(property_name, value)
+            root = built[0] if built else None
+            if parent is not None and isinstance(root, QLayout):
+                parent.setLayout(root)
+            elif parent is not None and isinstance(root, QWidget):
+                root.setParent(parent)
+            result['root'] = root
+        finally:
+            if parent is not None:
+                parent.setUpdatesEnabled(updates_enabled)
+
+        return result
+
+    def _resolve_sizes(self):
+        """
+        Internal function that scales the sizes of all the steps by the current DPI multiplier.
+        """
+
+        self._dpi_multiplier = dpi.dpi_multiplier()
+        self._scaled_sizes = [
+            (i, setter, dpi.dpi_scale(size)) for i, step in enumerate(self._steps) for setter, size in step.sizes]
+
+    @staticmethod
+    def _copy_kwargs(kwargs: dict[str, Any]) -> dict[str, Any]:
+        """
+        Internal function that returns a copy of the given keyword arguments where mutable containers are copied.
+
+        :param kwargs: step keyword arguments.
+        :return: keyword arguments to build step with.
+        """
+
+        return {k: copy.deepcopy(v) if isinstance(v, (list, dict, set)) else v for k, v in kwargs.items()}
+
+    @staticmethod
+    def _add_to_layout(layout: QLayout, built_object: QWidget | QLayout | None, step: UiPlanStep):
+        """
+        Internal function that adds given widget or layout into the given parent layout.
+
+        :param layout: parent layout.
+        :param built_object: widget or layout to add. None to add a stretch.
+        :param step: construction step.
+        """
+
+        if isinstance(layout, QGridLayout):
+            if isinstance(built_object, QLayout):
+                layout.addLayout(built_object, *step.cell)
+            else:
+                layout.addWidget(built_object, *step.cell)
+        elif built_object is None:
+            layout.addStretch(step.stretch)
+        elif isinstance(built_object, QLayout):
+            layout.addLayout(built_object, step.stretch)
+        else:
+            layout.addWidget(built_object, step.stretch)
+
+
+_LAYOUT_BUILDERS = ('vertical_layout', 'horizontal_layout', 'grid_layout')
+_SIZE_SETTERS = {
+    'min_width': QWidget.setMinimumWidth, 'max_width': QWidget.setMaximumWidth,
+    'min_height': QWidget.setMinimumHeight, 'max_height': QWidget.setMaximumHeight,
+    'fixed_width': QWidget.setFixedWidth, 'fixed_height': QWidget.setFixedHeight
+}
+
+
+def compile_ui_spec(spec: UiSpec | dict) -> UiPlan:
+    """
+    Validates given UI spec and compiles it into a construction plan.
+
+    :param spec: UI spec or dictionary (e.g: {'type': 'vertical_layout', 'children': [{'type': 'label', ...}]}).
+    :return: compiled UI plan.
+    :raises ValueError: if spec is not valid.
+    """
+
+    steps: list[UiPlanStep] = []
+
+    def _compile(_spec: UiSpec, _parent_index: int, _path: str):
+        if _spec.type == 'stretch':
+            if _parent_index < 0 or steps[_parent_index].builder not in (vertical_layout, horizontal_layout):
+                raise ValueError(f'{_path}: stretch must be a child of a box layout')
+            steps.append(UiPlanStep(None, {}, _parent_index, False, stretch=_spec.stretch))
+            return
+
+        builder = globals().get(_spec.type)
+        if not inspect.isfunction(builder) or builder.__module__ != __name__ or _spec.type.startswith('_') or \
+                _spec.type == compile_ui_spec.__name__:
+            raise ValueError(f'{_path}: "{_spec.type}" is not a valid factory function')
+        try:
+            inspect.signature(builder).bind(**_spec.kwargs)
+        except TypeError as exc:
+            raise ValueError(f'{_path}: invalid arguments for "{_spec.type}": {exc}')
+        is_layout = _spec.type in _LAYOUT_BUILDERS
+        if _spec.children and not is_layout:
+            raise ValueError(f'{_path}: only layouts can have children')
+        if _parent_index >= 0 and steps[_parent_index].builder is grid_layout and not _spec.cell:
+            raise ValueError(f'{_path}: children of grid layouts must define their cell')
+        if _spec.sizes and is_layout:
+            raise ValueError(f'{_path}: layouts cannot define sizes')
+        invalid_sizes = [size_name for size_name in _spec.sizes if size_name not in _SIZE_SETTERS]
+        if invalid_sizes:
+            raise ValueError(f'{_path}: invalid sizes {invalid_sizes}, valid ones are {list(_SIZE_SETTERS)}')
+
+        kwargs = {
+            k: resources.icon(v) if isinstance(v, str) and k.endswith('icon') else v for k, v in _spec.kwargs.items()}
+        sizes = tuple((_SIZE_SETTERS[size_name], size) for size_name, size in _spec.sizes.items())
+        properties = tuple(_spec.properties.items())
+        if _spec.prop:
+            properties += (('prop', _spec.prop),)
+        steps.append(UiPlanStep(
+            builder, kwargs, _parent_index, is_layout, name=_spec.name, prop=_spec.prop, stretch=_spec.stretch,
+            cell=_spec.cell, sizes=sizes, properties=properties))
+        index = len(steps) - 1
+        for i, child in enumerate(_spec.children):
+            _compile(child, index, f'{_path}.children[{i}]')
+
+    _compile(UiSpec.from_dict(spec), -1, spec.type if isinstance(spec, UiSpec) else spec.get('type', 'root'))
+
+    return UiPlan(steps)
@@ -1,10 +1,179 @@
 from __future__ import annotations
 
+import json
+import logging
 from typing import Iterable
 
 from . import dpi, pixmap
-from ..externals.Qt.QtCore import Qt, QSize
-from ..externals.Qt.QtGui import QColor, QIcon
+from ..resources import style
+from ..externals.Qt.QtCore import Qt, QSize, QRect
+from ..externals.Qt.QtGui import QGuiApplication, QColor, QIcon, QPixmap
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+
+class IconAtlas:
+    """
+    Class that gives access to the icons pre-rasterized at build time (see `tp.resources.style.build_atlas`).
+
+    Atlas image and index are loaded only once, and icon pixmaps are handed out as sub-rects of the atlas image.
+    """
+
+    _INSTANCE: IconAtlas | None = None
+
+    def __init__(self):
+        super().__init__()
+
+        self._image: QPixmap | None = None
+        self._index: dict[str, dict[str, dict[str, list[int]]]] = {}
+        self._pixmaps: dict[tuple[str, int, float], QPixmap] = {}
+        self._icons: dict[tuple[str, int], QIcon] = {}
+        self._loaded = False
+
+    @classmethod
+    def instance(cls) -> IconAtlas:
+        """
+        Returns global icon atlas instance.
+
+        :return: icon atlas.
+        """
+
+        if cls._INSTANCE is None:
+            cls._INSTANCE = cls()
+
+        return cls._INSTANCE
+
+    def is_available(self) -> bool:
+        """
+        Returns whether atlas was compiled into icons resources file.
+
+        :return: True if atlas is available; False otherwise.
+        """
+
+        self._load()
+        return self._image is not None
+
+    def has_icon(self, name: str) -> bool:
+        """
+        Returns whether icon with given logical name is packed within the atlas.
+
+        :param name: logical icon name (e.g: icons/close or style/icons/check).
+        :return: True if icon is within atlas; False otherwise.
+        """
+
+        self._load()
+        return name in self._index
+
+    def pixmap(self, name: str, size: int = 16, scale_factor: float | None = None) -> QPixmap | None:
+        """
+        Returns the pixmap of the icon with given name that better matches given size and scale factor.
+
+        :param name: logical icon name (e.g: icons/close or style/icons/check).
+        :param size: icon size before DPI scaling.
+        :param scale_factor: optional DPI scale factor. If not given, current DPI multiplier is used.
+        :return: icon pixmap or None if icon is not available within atlas.
+        """
+
+        self._load()
+        sizes = self._index.get(name)
+        if not sizes or str(size) not in sizes:
+            return None
+
+        variants = sizes[str(size)]
+        scale_factor = dpi.dpi_multiplier() if scale_factor is None else scale_factor
+        best_factor = min(variants, key=lambda factor: abs(float(factor) - scale_factor))
+        key = (name, size, float(best_factor))
+        found_pixmap = self._pixmaps.get(key)
+        if found_pixmap is None:
+            found_pixmap = self._image.copy(QRect(*variants[best_factor]))
+            self._pixmaps[key] = found_pixmap
+
+        return found_pixmap
+
+    def icon(self, name: str, size: int = 16) -> QIcon | None:
+        """
+        Returns an icon that contains all the pre-rasterized DPI variants of the icon with given name.
+
+        :param name: logical icon name (e.g: icons/close or style/icons/check).
+        :param size: icon size before DPI scaling.
+        :return: icon or None if icon is not available within atlas.
+        """
+
+        key = (name, size)
+        found_icon = self._icons.get(key)
+        if found_icon is not None:
+            return found_icon
+
+        self._load()
+        variants = self._index.get(name, {}).get(str(size))
+        if not variants:
+            return None
+
+        found_icon = QIcon()
+        for scale_factor in variants:
+            # variants are tagged with their pixel ratio, so they share the same logical size and the icon picks the
+            # variant that matches the device pixel ratio of the screen it is drawn in.
+            variant = QPixmap(self.pixmap(name, size=size, scale_factor=float(scale_factor)))
+            variant.setDevicePixelRatio(float(scale_factor))
+            found_icon.addPixmap(variant)
+        self._icons[key] = found_icon
+
+        return found_icon
+
+    def _load(self):
+        """
+        Internal function that loads atlas image and index generated by the atlas build step.
+        """
+
+        if self._loaded:
+            return
+        self._loaded = True
+
+        try:
+            with open(style.ATLAS_INDEX_PATH, 'r') as f:
+                index = json.load(f)
+        except (OSError, ValueError):
+            logger.debug('Icons atlas is not available. Run tp.resources.style.build_atlas to generate it.')
+            return
+        image = QPixmap(style.ATLAS_IMAGE_PATH)
+        if image.isNull():
+            logger.warning(f'Was not possible to load icons atlas image: {style.ATLAS_IMAGE_PATH}')
+            return
+
+        self._image = image
+        self._index = index.get('icons', {})
+
+
+def atlas_pixmap(name: str, size: int = 16, scale_factor: float | None = None) -> QPixmap | None:
+    """
+    Returns pre-rasterized pixmap from the icons atlas.
+
+    :param name: logical icon name (e.g: icons/close or style/icons/check).
+    :param size: icon size before DPI scaling.
+    :param scale_factor: optional DPI scale factor. If not given, current DPI multiplier is used.
+    :return: icon pixmap or None if icon is not available within atlas.
+    """
+
+    return IconAtlas.instance().pixmap(name, size=size, scale_factor=scale_factor)
+
+
+def atlas_icon(name: str, size: int = 16) -> QIcon | None:
+    """
+    Returns icon with all the pre-rasterized DPI variants from the icons atlas.
+
+    :param name: logical icon name (e.g: icons/close or style/icons/check).
+    :param size: icon size before DPI scaling.
+    :return: icon or None if icon is not available within atlas.
+    """
+
+    return IconAtlas.instance().icon(name, size=size)
 
 
 def colorize_icon(
@@ -21,22 +190,45 @@ def colorize_icon(
     :return: colorized icon.
     """
 
-    size = size or icon.availableSizes()[0]
+    available_sizes = icon.availableSizes()
+    size = size or (available_sizes[0].width() if available_sizes else 16)
     size = dpi.dpi_scale(size)
     if isinstance(size, (int, float)):
-        size = QSize(size, size)
+        size = QSize(int(size), int(size))
 
-    orig_size = icon.availableSizes()[0]
+    app = QGuiApplication.instance()
+    device_pixel_ratio = app.devicePixelRatio() if app is not None else 1.0
+    target_size = size * device_pixel_ratio
+    orig_size = _closest_icon_size(available_sizes, target_size) if available_sizes else target_size
     colorized_pixmap = pixmap.colorize_pixmap(icon.pixmap(orig_size), color)
     if overlay_icon is not None:
         overlay_pixmap = overlay_icon.pixmap(orig_size)
         pixmap.overlay_pixmap(colorized_pixmap, overlay_pixmap, overlay_color)
 
-    colorized_pixmap = colorized_pixmap.scaled(size, Qt.KeepAspectRatio, Qt.SmoothTransformation)
+    if colorized_pixmap.size() != target_size:
+        colorized_pixmap = colorized_pixmap.scaled(target_size, Qt.KeepAspectRatio, Qt.SmoothTransformation)
+    colorized_pixmap.setDevicePixelRatio(device_pixel_ratio)
 
     return QIcon(colorized_pixmap)
 
 
+def _closest_icon_size(sizes: list[QSize], target_size: QSize) -> QSize:
+    """
+    Internal function that returns the icon size that better matches the given one. Sizes bigger than the target one
+    are preferred, so pixmaps are scaled down instead of up.
+
+    :param sizes: available icon sizes.
+    :param target_size: size in device pixels.
+    :return: closest icon size.
+    """
+
+    bigger_sizes = [size for size in sizes if size.width() >= target_size.width()]
+    if bigger_sizes:
+        return min(bigger_sizes, key=lambda size: size.width())
+
+    return max(sizes, key=lambda size: size.width())
+
+
 def colorize_layered_icon(
         icons: list[QIcon], colors: Iterable[QColor] | None = None, scaling: list[float, float] | None = None):
     """
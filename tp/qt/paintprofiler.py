@@ -0,0 +1,477 @@
+from __future__ import annotations
+
+import os
+import json
+import time
+import weakref
+import logging
+from dataclasses import dataclass
+
+from ..externals.Qt.QtCore import Qt, QObject, QEvent, QPoint, QRect, QTimer
+from ..externals.Qt.QtWidgets import QWidget
+from ..externals.Qt.QtGui import QColor, QPainter, QPaintEvent
+from . import query
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+PROFILER_ENV_VAR = 'TP_DCC_PAINT_PROFILER'
+
+
+def is_profiler_available() -> bool:
+    """
+    Returns whether paint profiling tools should be exposed to the user (e.g: within window menus). They are only
+    exposed when TP_DCC_PAINT_PROFILER environment variable is set to a non-zero value.
+
+    :return: True if paint profiler is available; False otherwise.
+    """
+
+    return os.environ.get(PROFILER_ENV_VAR, '0').strip().lower() not in ('', '0', 'false', 'no')
+
+
+@dataclass
+class PaintStats:
+    """
+    Class that stores the paint cost of a widget or widget class.
+
+    Attributes
+    ----------
+    count : int
+        number of paint events.
+    total_ms : float
+        total time spent painting, in milliseconds.
+    max_ms : float
+        slowest paint event time, in milliseconds.
+    """
+
+    count: int = 0
+    total_ms: float = 0.0
+    max_ms: float = 0.0
+
+    @property
+    def average_ms(self) -> float:
+        """
+        Returns the average paint event time.
+
+        :return: average time, in milliseconds.
+        """
+
+        return self.total_ms / self.count if self.count else 0.0
+
+    def add(self, elapsed_ms: float):
+        """
+        Records a new paint event.
+
+        :param elapsed_ms: paint event time, in milliseconds.
+        """
+
+        self.count += 1
+        self.total_ms += elapsed_ms
+        self.max_ms = max(self.max_ms, elapsed_ms)
+
+    def to_dict(self) -> dict:
+        """
+        Returns a dictionary representation of this stats.
+
+        :return: stats dictionary.
+        """
+
+        return {
+            'count': self.count, 'total_ms': self.total_ms, 'average_ms': self.average_ms, 'max_ms': self.max_ms}
+
+
+class PaintProfiler(QObject):
+    """
+    Class that records how long each widget of a root widget tree takes to paint itself.
+
+    An event filter is installed on every widget of the tree (and on widgets added later on). Paint events are not
+    consumed, so other event filters still receive them. Qt paints a widget before its children, each of them within
+    its own paint event, so the paint time of a widget is measured from its paint event until the next paint event
+    of the same paint pass (or until the pass ends, for the last painted widget). Optionally, a heatmap overlay is
+    drawn on top of the root widget: the more time a widget has spent painting, the more opaque its rectangle is.
+
+    Paint passes are delimited by the UpdateRequest event of the top-level window: Qt paints all the dirty widgets and
+    flushes the backing store while handling that event. The filter receives it before the pass starts, so it
+    processes the event itself (painting and flushing the window) and closes the pass right after the flush. The event
+    is not consumed: when Qt delivers it afterwards, the backing store is already in sync and nothing is painted
+    again. Widgets painted outside of a backing store sync (e.g: by calling repaint) are closed on next event loop
+    iteration instead.
+    """
+
+    OVERLAY_INTERVAL = 1000         # overlay refresh interval, in milliseconds
+
+    def __init__(self, root: QWidget):
+        super().__init__()
+
+        self._root = weakref.ref(root)
+        self._enabled = False
+        self._suspended = 0
+        self._by_widget: weakref.WeakKeyDictionary[QWidget, PaintStats] = weakref.WeakKeyDictionary()
+        self._widget_names: weakref.WeakKeyDictionary[QWidget, str] = weakref.WeakKeyDictionary()
+        self._by_class: dict[str, PaintStats] = {}
+        self._window: weakref.ref | None = None
+        self._painting: tuple[weakref.ref, float] | None = None
+        self._in_pass = False
+        self._pass_end_scheduled = False
+        self._overlay: PaintHeatmapOverlay | None = None
+        self._overlay_timer = QTimer(parent=self)
+        self._overlay_timer.setInterval(self.OVERLAY_INTERVAL)
+        self._overlay_timer.timeout.connect(self._on_overlay_timer_timeout)
+
+    def is_enabled(self) -> bool:
+        """
+        Returns whether paint events are being recorded.
+
+        :return: True if profiler is enabled; False otherwise.
+        """
+
+        return self._enabled
+
+    def set_enabled(self, flag: bool, overlay: bool = True):
+        """
+        Sets whether paint events are recorded.
+
+        :param flag: True to start recording; False to stop it. Recorded stats are kept until reset is called.
+        :param overlay: whether to show the heatmap overlay while recording.
+        """
+
+        root = self._root()
+        if root is None or flag == self._enabled:
+            return
+
+        self._enabled = flag
+        if flag:
+            window = root.window()
+            self._window = weakref.ref(window)
+            if window is not root:
+                self._watch(window)
+            self._watch(root)
+            for widget in query.iterate_descendants(root):
+                if isinstance(widget, QWidget):
+                    self._watch(widget)
+            if overlay:
+                self._show_overlay(root)
+        else:
+            self._painting = None
+            window = self._window() if self._window is not None else None
+            self._window = None
+            if window is not None and window is not root:
+                self._unwatch(window)
+            self._unwatch(root)
+            for widget in query.iterate_descendants(root):
+                if isinstance(widget, QWidget):
+                    self._unwatch(widget)
+            self._hide_overlay()
+
+    def reset(self):
+        """
+        Clears all recorded stats.
+        """
+
+        self._by_widget.clear()
+        self._widget_names.clear()
+        self._by_class.clear()
+        if self._overlay is not None:
+            self._overlay.update()
+
+    def widget_stats(self) -> list[tuple[QWidget, PaintStats]]:
+        """
+        Returns the recorded stats of the live widgets, ranked by total paint time.
+
+        :return: list of widget and stats tuples.
+        """
+
+        return sorted(self._by_widget.items(), key=lambda item: item[1].total_ms, reverse=True)
+
+    def report(self, limit: int | None = None) -> dict:
+        """
+        Returns a ranked report of the recorded paint costs, by widget and by widget class.
+
+        :param limit: optional maximum number of entries of each ranking.
+        :return: paint cost report.
+        """
+
+        by_widget = [
+            dict(widget=self._widget_names.get(widget, type(widget).__name__), **stats.to_dict())
+            for widget, stats in self.widget_stats()[:limit]]
+        by_class = [
+            dict(widget_class=class_name, **stats.to_dict()) for class_name, stats in sorted(
+                self._by_class.items(), key=lambda item: item[1].total_ms, reverse=True)[:limit]]
+
+        return {
+            'total_ms': sum(stats.total_ms for stats in self._by_class.values()),
+            'count': sum(stats.count for stats in self._by_class.values()),
+            'by_widget': by_widget,
+            'by_class': by_class
+        }
+
+    def dump(self, file_path: str = '', limit: int | None = 20) -> dict:
+        """
+        Logs a ranked report of the recorded paint costs and optionally writes it into a JSON file.
+
+        :param file_path: optional JSON file path to write the report to.
+        :param limit: optional maximum number of entries of each ranking.
+        :return: paint cost report.
+        """
+
+        report = self.report(limit=limit)
+        lines = [f'Paint cost: {report["total_ms"]:.2f} ms in {report["count"]} paint events']
+        for entry in report['by_class']:
+            lines.append(
+                f'    {entry["widget_class"]}: {entry["total_ms"]:.2f} ms, {entry["count"]} paints, '
+                f'avg {entry["average_ms"]:.3f} ms, max {entry["max_ms"]:.3f} ms')
+        lines.append('Most expensive widgets:')
+        for entry in report['by_widget']:
+            lines.append(
+                f'    {entry["widget"]}: {entry["total_ms"]:.2f} ms, {entry["count"]} paints, '
+                f'avg {entry["average_ms"]:.3f} ms')
+        logger.info('\n'.join(lines))
+        if file_path:
+            with open(file_path, 'w') as f:
+                json.dump(report, f, indent=4)
+            logger.info(f'Paint report written to: {file_path}')
+
+        return report
+
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        """
+        Overrides base eventFilter function to time paint events and to watch widgets added to the tree.
+
+        :param watched: watched object.
+        :param event: Qt event.
+        :return: False, so event is always processed by the object.
+        """
+
+        event_type = event.type()
+        window = self._window() if self._window is not None else None
+        if event_type == QEvent.UpdateRequest and watched is window:
+            if not self._in_pass:
+                self._finish_painting(time.perf_counter())
+                self._in_pass = True
+                try:
+                    # paints the dirty widgets and flushes the backing store.
+                    watched.event(event)
+                finally:
+                    self._in_pass = False
+                    self._finish_painting(time.perf_counter())
+        elif event_type == QEvent.Paint:
+            now = time.perf_counter()
+            self._finish_painting(now)
+            if self._suspended:
+                return False
+            self._painting = (weakref.ref(watched), now)
+            if not self._in_pass and not self._pass_end_scheduled:
+                # widget is painted outside a backing store sync, so no UpdateRequest will close its paint.
+                self._pass_end_scheduled = True
+                QTimer.singleShot(0, self._on_paint_pass_finished)
+        elif event_type == QEvent.ChildAdded and (watched is not window or watched is self._root()):
+            child = event.child()
+            if isinstance(child, QWidget):
+                self._watch(child)
+                for widget in query.iterate_descendants(child):
+                    if isinstance(widget, QWidget):
+                        self._watch(widget)
+
+        return False
+
+    def _finish_painting(self, end: float):
+        """
+        Internal function that records the paint time of the widget that is being painted, if any.
+
+        :param end: time at which widget paint finished.
+        """
+
+        if self._painting is None:
+            return
+
+        widget_ref, start = self._painting
+        self._painting = None
+        widget = widget_ref()
+        if widget is not None:
+            self._record(widget, (end - start) * 1000.0)
+
+    def _suspend_recording(self):
+        """
+        Internal function that closes the paint of the widget that is being painted, if any, and stops recording paint
+        events until `_resume_recording` is called. Calls can be nested.
+        """
+
+        self._finish_painting(time.perf_counter())
+        self._suspended += 1
+
+    def _resume_recording(self):
+        """
+        Internal function that closes any paint done while recording was suspended and starts recording paint events
+        again.
+        """
+
+        self._finish_painting(time.perf_counter())
+        self._suspended = max(0, self._suspended - 1)
+
+    def _record(self, widget: QWidget, elapsed_ms: float):
+        """
+        Internal function that records a paint event of the given widget.
+
+        :param widget: painted widget.
+        :param elapsed_ms: paint event time, in milliseconds.
+        """
+
+        stats = self._by_widget.get(widget)
+        if stats is None:
+            stats = self._by_widget[widget] = PaintStats()
+            class_name = type(widget).__name__
+            object_name = widget.objectName()
+            self._widget_names[widget] = f'{class_name} ({object_name})' if object_name else class_name
+        stats.add(elapsed_ms)
+        class_name = type(widget).__name__
+        class_stats = self._by_class.get(class_name)
+        if class_stats is None:
+            class_stats = self._by_class[class_name] = PaintStats()
+        class_stats.add(elapsed_ms)
+
+    def _watch(self, widget: QWidget):
+        """
+        Internal function that starts watching the given widget paint events.
+
+        :param widget: widget to watch.
+        """
+
+        if isinstance(widget, PaintHeatmapOverlay):
+            return
+        # installing the same filter twice moves it to the front, but it is only called once.
+        widget.installEventFilter(self)
+
+    def _unwatch(self, widget: QWidget):
+        """
+        Internal function that stops watching the given widget paint events.
+
+        :param widget: widget to stop watching.
+        """
+
+        try:
+            widget.removeEventFilter(self)
+        except RuntimeError:
+            pass
+
+    def _show_overlay(self, root: QWidget):
+        """
+        Internal function that shows the heatmap overlay on top of the given root widget.
+
+        :param root: root widget.
+        """
+
+        if self._overlay is None:
+            self._overlay = PaintHeatmapOverlay(self, parent=root)
+        self._overlay.setGeometry(root.rect())
+        self._overlay.raise_()
+        self._overlay.show()
+        self._overlay_timer.start()
+
+    def _hide_overlay(self):
+        """
+        Internal function that hides and deletes the heatmap overlay.
+        """
+
+        self._overlay_timer.stop()
+        if self._overlay is None:
+            return
+        try:
+            self._overlay.hide()
+            self._overlay.deleteLater()
+        except RuntimeError:
+            pass
+        self._overlay = None
+
+    def _on_paint_pass_finished(self):
+        """
+        Internal callback function that is called after a paint pass to record the last painted widget.
+        """
+
+        self._pass_end_scheduled = False
+        self._finish_painting(time.perf_counter())
+
+    def _on_overlay_timer_timeout(self):
+        """
+        Internal callback function that is called periodically to refresh the heatmap overlay.
+        """
+
+        root = self._root()
+        if root is None or self._overlay is None:
+            return
+
+        # repainting the transparent overlay also repaints the widgets below it, which must not be recorded.
+        self._suspend_recording()
+        try:
+            if self._overlay.geometry() != root.rect():
+                self._overlay.setGeometry(root.rect())
+            self._overlay.raise_()
+            self._overlay.repaint()
+        finally:
+            self._resume_recording()
+
+
+class PaintHeatmapOverlay(QWidget):
+    """
+    Transparent widget that draws the paint cost of each profiled widget on top of the profiled root widget.
+    """
+
+    COLOR = QColor(255, 60, 30)
+    MAX_ALPHA = 180
+
+    def __init__(self, profiler: PaintProfiler, parent: QWidget):
+        super().__init__(parent)
+
+        self._profiler = profiler
+
+        self.setAttribute(Qt.WA_TransparentForMouseEvents)
+        self.setAttribute(Qt.WA_NoSystemBackground)
+        self.setFocusPolicy(Qt.NoFocus)
+
+    def paintEvent(self, event: QPaintEvent):
+        """
+        Overrides base paintEvent function to draw a rectangle over each profiled widget, whose opacity depends on the
+        time spent painting the widget.
+
+        :param event: Qt paint event.
+        """
+
+        # overlay is painted last, so its paint must not be charged to the widget painted just before it.
+        self._profiler._suspend_recording()
+        try:
+            self._paint_heatmap()
+        finally:
+            self._profiler._resume_recording()
+
+    def _paint_heatmap(self):
+        """
+        Internal function that draws the paint cost rectangle of each profiled widget.
+        """
+
+        root = self.parentWidget()
+        widget_stats = [
+            (widget, stats) for widget, stats in self._profiler.widget_stats()
+            if widget.isVisible() and root.isAncestorOf(widget)]
+        if not widget_stats:
+            return
+
+        highest_ms = widget_stats[0][1].total_ms or 1.0
+        painter = QPainter(self)
+        try:
+            color = QColor(self.COLOR)
+            # cheapest widgets are painted first, so expensive ones are drawn on top.
+            for widget, stats in reversed(widget_stats):
+                ratio = stats.total_ms / highest_ms
+                color.setAlpha(int(self.MAX_ALPHA * ratio))
+                rect = QRect(widget.mapTo(root, QPoint(0, 0)), widget.size())
+                painter.fillRect(rect, color)
+                if ratio > 0.25 and rect.height() >= 12:
+                    painter.setPen(Qt.white)
+                    painter.drawText(rect, Qt.AlignLeft | Qt.AlignTop, f' {stats.total_ms:.1f} ms / {stats.count}')
+        finally:
+            painter.end()
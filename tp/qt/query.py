@@ -0,0 +1,250 @@
+from __future__ import annotations
+
+import weakref
+import logging
+from typing import Type, Any, Iterator
+
+from ..externals.Qt.QtCore import QObject, QEvent
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+_MISSING = object()
+_INVALIDATING_EVENTS = (QEvent.ChildAdded, QEvent.ChildRemoved, QEvent.DynamicPropertyChange)
+_INDEXES: weakref.WeakKeyDictionary[QObject, dict[str | None, TreeIndex]] = weakref.WeakKeyDictionary()
+
+
+def iterate_descendants(root: QObject, skip: str | None = None) -> Iterator[QObject]:
+    """
+    Iterates over all the descendants of the given object, in depth-first pre-order, without recursion.
+
+    :param root: object whose descendants to iterate over.
+    :param skip: optional name of a dynamic property. Descendants of objects where that property is True are skipped
+        (objects themselves are still returned).
+    :return: iterator of descendant objects.
+    """
+
+    stack = list(reversed(root.children()))
+    while stack:
+        child = stack.pop()
+        yield child
+        if skip is not None and child.property(skip):
+            continue
+        children = child.children()
+        if children:
+            stack.extend(reversed(children))
+
+
+class TreeIndex(QObject):
+    """
+    Class that indexes all the descendants of a root object by class and by dynamic property name, so repeated
+    lookups only visit the matching objects.
+
+    Index is built lazily, with a single walk of the tree. The root and all the indexed objects (leaves included) are
+    watched: index is invalidated when any of them gets a child added or removed or a dynamic property changed.
+    Descendants of skipped objects are not indexed, so they are not watched either.
+
+    Indexed objects are dropped as soon as the index is invalidated, so a dirty index never keeps deleted wrappers
+    (or the whole tree) alive.
+    """
+
+    def __init__(self, root: QObject, skip: str | None = None):
+        super().__init__()
+
+        self._root = weakref.ref(root)
+        self._skip = skip
+        self._dirty = True
+        self._order: dict[int, int] = {}
+        self._by_class: dict[type, list[QObject]] = {}
+        self._by_property: dict[str, list[QObject]] = {}
+        self._objects: list[QObject] = []
+
+    def is_dirty(self) -> bool:
+        """
+        Returns whether index must be rebuilt before next lookup.
+
+        :return: True if index is dirty; False otherwise.
+        """
+
+        return self._dirty
+
+    def invalidate(self):
+        """
+        Marks index as dirty, so it is rebuilt on next lookup.
+        """
+
+        self._dirty = True
+        self._clear()
+
+    def objects(self) -> list[QObject]:
+        """
+        Returns all indexed objects, in tree order.
+
+        :return: indexed objects.
+        """
+
+        self._ensure_built()
+        return self._objects
+
+    def by_class(self, cls: Type | tuple[Type, ...]) -> list[QObject]:
+        """
+        Returns all indexed objects that are instances of the given class, in tree order.
+
+        :param cls: class or tuple of classes to match.
+        :return: matching objects.
+        """
+
+        self._ensure_built()
+        groups = [objects for object_type, objects in self._by_class.items() if issubclass(object_type, cls)]
+        if len(groups) == 1:
+            return list(groups[0])
+        found = [obj for objects in groups for obj in objects]
+        found.sort(key=lambda obj: self._order[id(obj)])
+
+        return found
+
+    def by_property(self, name: str) -> list[QObject]:
+        """
+        Returns all indexed objects that define the given dynamic property, in tree order.
+
+        :param name: dynamic property name.
+        :return: matching objects.
+        """
+
+        self._ensure_built()
+        return list(self._by_property.get(name, ()))
+
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        """
+        Overrides base eventFilter function to invalidate index when tree changes.
+
+        :param watched: watched object.
+        :param event: Qt event.
+        :return: False, so event is always processed by the object.
+        """
+
+        if not self._dirty and event.type() in _INVALIDATING_EVENTS:
+            self.invalidate()
+
+        return False
+
+    def _clear(self):
+        """
+        Internal function that drops all the indexed objects.
+
+        ..note:: containers are replaced instead of cleared, so lists already returned by `objects` are not modified.
+        """
+
+        self._order = {}
+        self._by_class = {}
+        self._by_property = {}
+        self._objects = []
+
+    def _ensure_built(self):
+        """
+        Internal function that rebuilds the index if it is dirty.
+        """
+
+        if not self._dirty:
+            return
+
+        self._clear()
+        root = self._root()
+        if root is None:
+            self._dirty = False
+            return
+
+        # event filters are installed before walking the tree, so changes done while walking invalidate the index.
+        self._dirty = False
+        root.installEventFilter(self)
+        for i, obj in enumerate(iterate_descendants(root, skip=self._skip)):
+            obj.installEventFilter(self)
+            self._objects.append(obj)
+            self._order[id(obj)] = i
+            self._by_class.setdefault(type(obj), []).append(obj)
+            for property_name in obj.dynamicPropertyNames():
+                self._by_property.setdefault(bytes(property_name).decode('utf-8'), []).append(obj)
+
+
+def index(root: QObject, skip: str | None = None) -> TreeIndex:
+    """
+    Returns the index of the given root object, creating it if it does not exist yet.
+
+    :param root: root object.
+    :param skip: optional name of a dynamic property. Descendants of objects where that property is True are not
+        indexed.
+    :return: root tree index.
+    """
+
+    root_indexes = _INDEXES.get(root)
+    if root_indexes is None:
+        root_indexes = _INDEXES[root] = {}
+    tree_index = root_indexes.get(skip)
+    if tree_index is None:
+        tree_index = root_indexes[skip] = TreeIndex(root, skip=skip)
+
+    return tree_index
+
+
+def query(
+        root: QObject, cls: Type | tuple[Type, ...] | None = None, prop: str | None = None, value: Any = _MISSING,
+        name: str | None = None, skip: str | None = None, indexed: bool = True) -> list[QObject]:
+    """
+    Returns the descendants of the given root object that match all the given filters, in tree order.
+
+    :param root: root object.
+    :param cls: optional class or tuple of classes descendants must be instances of.
+    :param prop: optional name of a dynamic property descendants must define (with a non-None value).
+    :param value: optional value the dynamic property must have. Only used if prop is given.
+    :param name: optional object name descendants must have.
+    :param skip: optional name of a dynamic property. Descendants of objects where that property is True are
+        ignored.
+    :param indexed: whether to use (and build, if needed) the cached index of the root object. Indexed lookups only
+        visit the matching objects; use False for one-off queries over trees that change constantly.
+    :return: matching objects.
+    """
+
+    if indexed:
+        tree_index = index(root, skip=skip)
+        if prop is not None:
+            candidates = tree_index.by_property(prop)
+            if cls is not None:
+                candidates = [obj for obj in candidates if isinstance(obj, cls)]
+        elif cls is not None:
+            candidates = tree_index.by_class(cls)
+        else:
+            candidates = list(tree_index.objects())
+    else:
+        candidates = [
+            obj for obj in iterate_descendants(root, skip=skip) if cls is None or isinstance(obj, cls)]
+
+    found: list[QObject] = []
+    for obj in candidates:
+        if prop is not None:
+            property_value = obj.property(prop)
+            if property_value is None or (value is not _MISSING and property_value != value):
+                continue
+        if name is not None and obj.objectName() != name:
+            continue
+        found.append(obj)
+
+    return found
+
+
+def invalidate(root: QObject | None = None):
+    """
+    Invalidates cached indexes, so they are rebuilt on next query.
+
+    :param root: optional root object whose indexes are invalidated. If not given, all indexes are invalidated.
+    """
+
+    roots = [root] if root is not None else list(_INDEXES.keys())
+    for index_root in roots:
+        for tree_index in _INDEXES.get(index_root, {}).values():
+            tree_index.invalidate()
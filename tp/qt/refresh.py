@@ -0,0 +1,154 @@
+from __future__ import annotations
+
+import logging
+from typing import Callable
+
+from ..externals.Qt.QtCore import QObject, QTimer
+from ..externals.Qt.QtWidgets import QWidget
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+_REFRESH_SCHEDULER: RefreshScheduler | None = None
+
+
+class RefreshScheduler(QObject):
+    """
+    Class that coalesces widget refresh requests. Requests are stored keyed by widget, so requesting the same work for
+    a widget many times within an event loop iteration only does it once.
+
+    Pending requests are flushed once per event loop iteration, in dependency order: widgets are restyled first
+    (style changes size hints), then refreshed (e.g: updated from their linked property values) and finally their
+    layouts are activated.
+    """
+
+    MAX_PASSES = 4
+
+    def __init__(self):
+        super().__init__()
+
+        self._restyle: dict[QWidget, None] = {}
+        self._refresh: dict[tuple[QWidget, Callable], None] = {}
+        self._relayout: dict[QWidget, None] = {}
+        self._flushing = False
+        self._timer = QTimer(parent=self)
+        self._timer.setSingleShot(True)
+        self._timer.setInterval(0)
+        self._timer.timeout.connect(self.flush)
+
+    def restyle(self, widget: QWidget):
+        """
+        Requests given widget style to be recomputed (unpolish and polish).
+
+        :param widget: widget to restyle.
+        """
+
+        self._restyle[widget] = None
+        self._start()
+
+    def refresh(self, widget: QWidget, func: Callable[[], None]):
+        """
+        Requests given function to be called to refresh given widget. Requests with same widget and function (e.g:
+        same bound method) are only called once.
+
+        :param widget: widget to refresh.
+        :param func: function that refreshes the widget.
+        """
+
+        self._refresh[(widget, func)] = None
+        self._start()
+
+    def relayout(self, widget: QWidget):
+        """
+        Requests given widget layout to be updated and activated.
+
+        :param widget: widget to relayout.
+        """
+
+        self._relayout[widget] = None
+        self._start()
+
+    def is_pending(self, widget: QWidget) -> bool:
+        """
+        Returns whether given widget has pending requests.
+
+        :param widget: widget to check.
+        :return: True if widget has pending requests; False otherwise.
+        """
+
+        return widget in self._restyle or widget in self._relayout or any(
+            key[0] is widget for key in self._refresh)
+
+    def flush(self):
+        """
+        Applies all pending requests. Requests done while flushing are applied within the same flush.
+        """
+
+        self._timer.stop()
+        if self._flushing:
+            return
+
+        self._flushing = True
+        try:
+            for _ in range(self.MAX_PASSES):
+                if not self._restyle and not self._refresh and not self._relayout:
+                    break
+                restyle, self._restyle = self._restyle, {}
+                for widget in restyle:
+                    try:
+                        widget.setStyle(widget.style())
+                    except RuntimeError:
+                        # Qt object was already deleted.
+                        continue
+                refresh, self._refresh = self._refresh, {}
+                for widget, func in refresh:
+                    try:
+                        func()
+                    except RuntimeError:
+                        continue
+                    except Exception:
+                        logger.exception(f'Error while refreshing widget: {widget}')
+                relayout, self._relayout = self._relayout, {}
+                for widget in relayout:
+                    try:
+                        widget_layout = widget.layout()
+                        if widget_layout:
+                            widget_layout.update()
+                            widget_layout.activate()
+                    except RuntimeError:
+                        continue
+            else:
+                if self._restyle or self._refresh or self._relayout:
+                    logger.warning('Widget refresh requests keep being added while flushing, applying them later')
+                    self._timer.start()
+        finally:
+            self._flushing = False
+
+    def _start(self):
+        """
+        Internal function that starts the flush timer, if it is not running already.
+        """
+
+        if not self._flushing and not self._timer.isActive():
+            self._timer.start()
+
+
+def refresh_scheduler() -> RefreshScheduler:
+    """
+    Returns global refresh scheduler instance.
+
+    :return: refresh scheduler.
+    """
+
+    global _REFRESH_SCHEDULER
+
+    if _REFRESH_SCHEDULER is None:
+        _REFRESH_SCHEDULER = RefreshScheduler()
+
+    return _REFRESH_SCHEDULER
@@ -0,0 +1,450 @@
+from __future__ import annotations
+
+import os
+import re
+import json
+import time
+import base64
+import atexit
+import logging
+import platform
+import tempfile
+import threading
+from typing import Any, Callable
+
+from ..externals.Qt.QtCore import Qt, QObject, Signal, QSettings, QByteArray, QPoint, QSize
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+SETTINGS_FOLDER_NAME = 'window_settings'
+# previous versions stored the settings of each window within its own QSettings INI file (e.g: tp/MyWindow.ini).
+LEGACY_SETTINGS_GROUP_PREFIX = 'tp'
+LEGACY_SETTINGS_KEYS = ('geometry', 'saveState', 'maximized', 'pos', 'size')
+DEFAULT_DEBOUNCE_INTERVAL = 1.0
+
+_SETTINGS_STORE: SettingsStore | None = None
+_INVALID_FILE_NAME_CHARACTERS = re.compile(r'[^\w.-]+')
+
+
+def settings_folder() -> str:
+    """
+    Returns the folder where user settings files are stored.
+
+    :return: absolute settings folder path.
+    """
+
+    if platform.system().lower() == 'windows':
+        root = os.environ.get('APPDATA') or os.path.expanduser('~')
+    else:
+        root = os.environ.get('XDG_CONFIG_HOME') or os.path.join(os.path.expanduser('~'), '.config')
+
+    return os.path.join(root, 'tp')
+
+
+class _LoadNotifier(QObject):
+    """
+    Internal class used to notify, from the thread that created the settings store, that settings were loaded.
+    """
+
+    loaded = Signal()
+
+
+class SettingsStore:
+    """
+    Class that stores the settings of each group (e.g: each window) within its own JSON file.
+
+    Files are loaded only once, in a background thread, and kept in memory. Changes are batched and debounced: they
+    are written by the background thread once no more changes happen during the debounce interval, using temporary
+    files that atomically replace the settings files. Only the files of the changed groups are written, so processes
+    that show different windows (e.g: standalone tools) do not overwrite each other settings.
+
+    Reading settings before files are loaded would block, so callers in the UI thread should use `when_loaded`.
+    """
+
+    def __init__(self, folder_path: str, debounce_interval: float = DEFAULT_DEBOUNCE_INTERVAL):
+        self._folder_path = folder_path
+        self._debounce_interval = debounce_interval
+        self._data: dict[str, dict[str, Any]] = {}
+        self._dirty: set[str] = set()
+        self._condition = threading.Condition()
+        self._loaded = threading.Event()
+        self._loaded_callbacks: list[Callable[[], None]] = []
+        self._notifier = _LoadNotifier()
+        self._notifier.loaded.connect(self._on_loaded, Qt.QueuedConnection)
+        self._version = 0
+        self._written_version = 0
+        self._last_change = 0.0
+        self._flush_requested = False
+        self._closed = False
+        self._thread = threading.Thread(target=self._run, name='tp-settings-store', daemon=True)
+        self._thread.start()
+
+    @property
+    def folder_path(self) -> str:
+        """
+        Returns settings folder path.
+
+        :return: absolute settings folder path.
+        """
+
+        return self._folder_path
+
+    def file_path(self, name: str) -> str:
+        """
+        Returns the path of the file where the settings of the group with given name are stored.
+
+        :param name: name of the settings group (e.g: tp/MyToolWindow).
+        :return: absolute settings file path.
+        """
+
+        return os.path.join(self._folder_path, f'{_INVALID_FILE_NAME_CHARACTERS.sub("_", name)}.json')
+
+    def is_loaded(self) -> bool:
+        """
+        Returns whether settings files were already loaded, so reading settings does not block.
+
+        :return: True if settings are loaded; False otherwise.
+        """
+
+        return self._loaded.is_set()
+
+    def when_loaded(self, callback: Callable[[], None]):
+        """
+        Calls given function once settings files are loaded. If they are already loaded, function is called right
+        away; otherwise, it is called from the event loop of the thread that created this store.
+
+        :param callback: function to call.
+        """
+
+        with self._condition:
+            if not self._loaded.is_set():
+                self._loaded_callbacks.append(callback)
+                return
+
+        callback()
+
+    def group(self, name: str) -> dict[str, Any]:
+        """
+        Returns all the settings stored within the group with given name. Blocks until settings files are loaded.
+
+        :param name: name of the settings group (e.g: tp/MyToolWindow).
+        :return: dictionary with the decoded settings values.
+        """
+
+        self._loaded.wait()
+        with self._condition:
+            values = dict(self._data.get(name, {}))
+
+        return {key: _decode(value) for key, value in values.items()}
+
+    def value(self, name: str, key: str, default: Any = None) -> Any:
+        """
+        Returns the value of a setting. Blocks until settings files are loaded.
+
+        :param name: name of the settings group.
+        :param key: setting key.
+        :param default: value returned if setting does not exist.
+        :return: decoded setting value.
+        """
+
+        self._loaded.wait()
+        with self._condition:
+            value = self._data.get(name, {}).get(key, None)
+
+        return _decode(value) if value is not None else default
+
+    def set_value(self, name: str, key: str, value: Any):
+        """
+        Sets the value of a setting. Value is written to disk asynchronously.
+
+        :param name: name of the settings group.
+        :param key: setting key.
+        :param value: value to set. Python builtin types, QByteArray, QPoint and QSize values are supported.
+        """
+
+        self.update(name, {key: value})
+
+    def update(self, name: str, values: dict[str, Any]):
+        """
+        Sets multiple settings of a group at once. Values are written to disk asynchronously, within a single write.
+        It does not block if settings files are not loaded yet: given values take precedence over loaded ones.
+
+        :param name: name of the settings group.
+        :param values: dictionary with the setting keys and values to set.
+        """
+
+        encoded = {key: _encode(value) for key, value in values.items()}
+        with self._condition:
+            group = self._data.setdefault(name, {})
+            if all(group.get(key) == value for key, value in encoded.items()):
+                return
+            group.update(encoded)
+            self._dirty.add(name)
+            self._version += 1
+            self._last_change = time.monotonic()
+            self._condition.notify_all()
+
+    def remove(self, name: str, key: str | None = None):
+        """
+        Removes a setting or a whole settings group. Blocks until settings files are loaded.
+
+        :param name: name of the settings group.
+        :param key: optional setting key. If not given, the whole group is removed.
+        """
+
+        self._loaded.wait()
+        with self._condition:
+            if name not in self._data:
+                return
+            if key is None:
+                self._data.pop(name)
+            elif self._data[name].pop(key, None) is None:
+                return
+            self._dirty.add(name)
+            self._version += 1
+            self._last_change = time.monotonic()
+            self._condition.notify_all()
+
+    def flush(self, wait: bool = True, timeout: float | None = None):
+        """
+        Forces pending changes to be written without waiting for the debounce interval.
+
+        :param wait: whether to block until changes are written.
+        :param timeout: optional maximum time in seconds to wait for.
+        """
+
+        with self._condition:
+            version = self._version
+            if self._written_version >= version:
+                return
+            self._flush_requested = True
+            self._condition.notify_all()
+            if wait:
+                self._condition.wait_for(lambda: self._written_version >= version or self._closed, timeout)
+
+    def close(self):
+        """
+        Writes pending changes and stops the background thread.
+        """
+
+        self.flush(wait=True, timeout=5.0)
+        with self._condition:
+            self._closed = True
+            self._condition.notify_all()
+
+    def _run(self):
+        """
+        Internal function that loads the settings files and writes pending changes. It runs in a background thread.
+        """
+
+        self._load()
+        while True:
+            with self._condition:
+                self._condition.wait_for(lambda: self._version > self._written_version or self._closed)
+                if self._version <= self._written_version:
+                    return
+                # debounce: wait until no more changes happen during the debounce interval.
+                while not self._flush_requested and not self._closed:
+                    remaining = self._last_change + self._debounce_interval - time.monotonic()
+                    if remaining <= 0:
+                        break
+                    self._condition.wait(remaining)
+                version = self._version
+                contents = {
+                    name: json.dumps({'group': name, 'values': self._data[name]}, indent=1, sort_keys=True)
+                    if name in self._data else None for name in self._dirty}
+                self._dirty = set()
+                self._flush_requested = False
+            for name, group_contents in contents.items():
+                self._write(self.file_path(name), group_contents)
+            with self._condition:
+                self._written_version = version
+                self._condition.notify_all()
+
+    def _load(self):
+        """
+        Internal function that loads settings files contents into memory. Values set before loading finished take
+        precedence over the loaded ones. Groups without settings file are seeded from the legacy QSettings INI files,
+        and they are written into their own settings files, so legacy files are only read once.
+        """
+
+        loaded: dict[str, dict[str, Any]] = {}
+        migrated: set[str] = set()
+        try:
+            if os.path.isdir(self._folder_path):
+                for entry in os.scandir(self._folder_path):
+                    if not entry.name.endswith('.json'):
+                        continue
+                    data = _read_json(entry.path)
+                    if isinstance(data, dict) and isinstance(data.get('values'), dict) and data.get('group'):
+                        loaded[data['group']] = data['values']
+            legacy_folder = os.path.dirname(self._folder_path)
+            if os.path.isdir(legacy_folder):
+                for entry in os.scandir(legacy_folder):
+                    if not entry.name.endswith('.ini'):
+                        continue
+                    name = f'{LEGACY_SETTINGS_GROUP_PREFIX}/{os.path.splitext(entry.name)[0]}'
+                    if name in loaded:
+                        continue
+                    values = _read_legacy_settings(entry.path)
+                    if values:
+                        loaded[name] = values
+                        migrated.add(name)
+        except OSError:
+            logger.warning(f'Was not possible to load settings from: {self._folder_path}', exc_info=True)
+        finally:
+            with self._condition:
+                for name, values in loaded.items():
+                    self._data[name] = {**values, **self._data.get(name, {})}
+                if migrated:
+                    self._dirty.update(migrated)
+                    self._version += 1
+                    self._last_change = time.monotonic()
+                self._loaded.set()
+            self._notifier.loaded.emit()
+
+    @staticmethod
+    def _write(file_path: str, contents: str | None):
+        """
+        Internal function that writes given contents into a settings file, replacing it atomically.
+
+        :param file_path: absolute settings file path.
+        :param contents: settings file contents. If None, settings file is removed.
+        """
+
+        folder = os.path.dirname(file_path)
+        try:
+            if contents is None:
+                if os.path.isfile(file_path):
+                    os.remove(file_path)
+                return
+            if not os.path.isdir(folder):
+                os.makedirs(folder)
+            file_descriptor, temp_path = tempfile.mkstemp(prefix='.settings_', suffix='.tmp', dir=folder)
+            try:
+                with os.fdopen(file_descriptor, 'w') as f:
+                    f.write(contents)
+                os.replace(temp_path, file_path)
+            except OSError:
+                os.remove(temp_path)
+                raise
+        except OSError:
+            logger.warning(f'Was not possible to write settings file: {file_path}', exc_info=True)
+
+    def _on_loaded(self):
+        """
+        Internal callback function that is called, within the thread that created this store, once settings files
+        are loaded.
+        """
+
+        with self._condition:
+            callbacks, self._loaded_callbacks = self._loaded_callbacks, []
+        for callback in callbacks:
+            try:
+                callback()
+            except RuntimeError:
+                # Qt object was already deleted.
+                continue
+            except Exception:
+                logger.exception('Error while applying loaded settings')
+
+
+def settings_store() -> SettingsStore:
+    """
+    Returns global settings store instance. Pending changes are written when the interpreter exits.
+
+    :return: settings store.
+    """
+
+    global _SETTINGS_STORE
+
+    if _SETTINGS_STORE is None:
+        _SETTINGS_STORE = SettingsStore(os.path.join(settings_folder(), SETTINGS_FOLDER_NAME))
+        atexit.register(_SETTINGS_STORE.close)
+
+    return _SETTINGS_STORE
+
+
+def _read_json(file_path: str) -> Any:
+    """
+    Internal function that returns the contents of the given JSON file.
+
+    :param file_path: absolute JSON file path.
+    :return: file contents or None if file could not be read.
+    """
+
+    try:
+        with open(file_path, 'r') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        logger.warning(f'Was not possible to load settings file: {file_path}', exc_info=True)
+        return None
+
+
+def _read_legacy_settings(file_path: str) -> dict[str, Any]:
+    """
+    Internal function that returns the window settings stored within the given legacy QSettings INI file.
+
+    :param file_path: absolute INI file path.
+    :return: dictionary with the encoded settings values. Empty if file does not contain window settings.
+    """
+
+    legacy_settings = QSettings(file_path, QSettings.IniFormat)
+    values: dict[str, Any] = {}
+    for key in LEGACY_SETTINGS_KEYS:
+        value = legacy_settings.value(key)
+        if value is None:
+            continue
+        # INI files store booleans as strings.
+        if isinstance(value, str) and value.lower() in ('true', 'false'):
+            value = value.lower() == 'true'
+        values[key] = _encode(value)
+
+    return values
+
+
+def _encode(value: Any) -> Any:
+    """
+    Internal function that converts given value into a JSON serializable value.
+
+    :param value: value to encode.
+    :return: encoded value.
+    """
+
+    if isinstance(value, QByteArray):
+        return {'__type__': 'QByteArray', 'value': base64.b64encode(bytes(value)).decode('ascii')}
+    elif isinstance(value, QPoint):
+        return {'__type__': 'QPoint', 'value': [value.x(), value.y()]}
+    elif isinstance(value, QSize):
+        return {'__type__': 'QSize', 'value': [value.width(), value.height()]}
+
+    return value
+
+
+def _decode(value: Any) -> Any:
+    """
+    Internal function that converts given encoded value into its original type.
+
+    :param value: value to decode.
+    :return: decoded value.
+    """
+
+    if not isinstance(value, dict) or '__type__' not in value:
+        return value
+
+    value_type = value['__type__']
+    if value_type == 'QByteArray':
+        return QByteArray(base64.b64decode(value['value']))
+    elif value_type == 'QPoint':
+        return QPoint(*value['value'])
+    elif value_type == 'QSize':
+        return QSize(*value['value'])
+
+    return value
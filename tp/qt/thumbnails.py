@@ -0,0 +1,413 @@
+from __future__ import annotations
+
+import os
+import weakref
+import hashlib
+import logging
+import platform
+import collections
+from typing import Callable
+from dataclasses import dataclass, field
+from concurrent.futures import ThreadPoolExecutor
+
+from ..externals.Qt.QtCore import Qt, QObject, Signal, QSize, QEvent, QTimer
+from ..externals.Qt.QtWidgets import QWidget, QLabel
+from ..externals.Qt.QtGui import QImage, QImageReader, QPixmap, QColor
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+MAX_WORKERS = max(1, min(4, (os.cpu_count() or 2) - 1))
+MEMORY_CACHE_SIZE = 512
+PLACEHOLDER_COLOR = QColor(128, 128, 128, 60)
+
+_THUMBNAIL_LOADER: ThumbnailLoader | None = None
+
+
+def cache_folder() -> str:
+    """
+    Returns the folder where thumbnails are cached on disk.
+
+    :return: absolute thumbnails cache folder path.
+    """
+
+    if platform.system().lower() == 'windows':
+        root = os.environ.get('LOCALAPPDATA') or os.path.expanduser('~')
+    else:
+        root = os.environ.get('XDG_CACHE_HOME') or os.path.join(os.path.expanduser('~'), '.cache')
+
+    return os.path.join(root, 'tp', 'thumbnails')
+
+
+@dataclass
+class ThumbnailRequest:
+    """
+    Class that defines a request to load an image into a widget.
+
+    Attributes
+    ----------
+    key : tuple[str, int, int]
+        key of the image to load (path and size in device pixels).
+    widget : weakref.ref
+        weak reference to the widget the image is loaded for.
+    callback : Callable[[QPixmap], None]
+        function called with the loaded pixmap.
+    device_pixel_ratio : float
+        device pixel ratio of the widget screen.
+    """
+
+    key: tuple[str, int, int]
+    widget: weakref.ref
+    callback: Callable[[QPixmap], None] = field(repr=False)
+    device_pixel_ratio: float = 1.0
+
+    def target(self) -> QWidget | None:
+        """
+        Returns the widget the image is loaded for.
+
+        :return: target widget or None if widget was deleted.
+        """
+
+        widget = self.widget()
+        if widget is None:
+            return None
+        try:
+            widget.objectName()
+        except RuntimeError:
+            # Qt object was already deleted.
+            return None
+
+        return widget
+
+
+class ThumbnailLoader(QObject):
+    """
+    Class that loads images asynchronously.
+
+    Images are decoded and scaled to the requested size (in device pixels) within a thread pool, so decoding hundreds
+    of thumbnails never stalls the UI. Loaded images are sent back to the UI thread through a queued signal, converted
+    to pixmaps and cached in memory (LRU) and, optionally, on disk at the requested size.
+
+    Requests are only submitted to the thread pool while their widget is visible on screen: requests of deleted
+    widgets are dropped and requests of hidden or scrolled out widgets wait until widget is painted again.
+    """
+
+    _imageLoaded = Signal(object, object)
+
+    def __init__(self, disk_cache_folder: str | None = None, memory_cache_size: int = MEMORY_CACHE_SIZE):
+        super().__init__()
+
+        self._disk_cache_folder = disk_cache_folder
+        self._memory_cache_size = memory_cache_size
+        self._memory_cache: collections.OrderedDict[tuple[str, int, int], QPixmap] = collections.OrderedDict()
+        self._pending: collections.OrderedDict[int, ThumbnailRequest] = collections.OrderedDict()
+        self._parked: dict[int, ThumbnailRequest] = {}
+        self._in_flight: dict[tuple[str, int, int], list[ThumbnailRequest]] = {}
+        self._watched: weakref.WeakSet[QWidget] = weakref.WeakSet()
+        self._placeholders: dict[tuple[int, int], QPixmap] = {}
+        self._executor = ThreadPoolExecutor(max_workers=MAX_WORKERS, thread_name_prefix='tp-thumbnail')
+        self._dispatch_timer = QTimer(parent=self)
+        self._dispatch_timer.setSingleShot(True)
+        self._dispatch_timer.setInterval(0)
+        self._dispatch_timer.timeout.connect(self._dispatch)
+
+        self._imageLoaded.connect(self._on_image_loaded, Qt.QueuedConnection)
+
+    @property
+    def disk_cache_folder(self) -> str | None:
+        """
+        Returns folder where thumbnails are cached on disk.
+
+        :return: disk cache folder or None if disk cache is disabled.
+        """
+
+        return self._disk_cache_folder
+
+    @disk_cache_folder.setter
+    def disk_cache_folder(self, value: str | None):
+        """
+        Sets folder where thumbnails are cached on disk.
+
+        :param value: disk cache folder. If None, disk cache is disabled.
+        """
+
+        self._disk_cache_folder = value
+
+    def placeholder(self, size: QSize) -> QPixmap:
+        """
+        Returns placeholder pixmap shown while images are loading.
+
+        :param size: placeholder size.
+        :return: placeholder pixmap.
+        """
+
+        key = (size.width(), size.height())
+        pixmap = self._placeholders.get(key)
+        if pixmap is None:
+            pixmap = QPixmap(size)
+            pixmap.fill(PLACEHOLDER_COLOR)
+            self._placeholders[key] = pixmap
+
+        return pixmap
+
+    def cached(self, path: str, size: QSize, device_pixel_ratio: float = 1.0) -> QPixmap | None:
+        """
+        Returns the pixmap of the given image if it is already loaded in memory.
+
+        :param path: image path.
+        :param size: image size (in logical pixels).
+        :param device_pixel_ratio: device pixel ratio the image is loaded for.
+        :return: cached pixmap or None if image is not loaded yet.
+        """
+
+        return self._cached(self._key(path, size, device_pixel_ratio))
+
+    def request(self, widget: QWidget, path: str, size: QSize, callback: Callable[[QPixmap], None]):
+        """
+        Requests given image to be loaded for the given widget. If image is already in memory, callback is called
+        immediately. Any previous request done for the same widget is cancelled.
+
+        :param widget: widget the image is loaded for.
+        :param path: image path.
+        :param size: image size (in logical pixels). Image is scaled keeping its aspect ratio.
+        :param callback: function called with the loaded pixmap.
+        """
+
+        self.cancel(widget)
+
+        device_pixel_ratio = widget.devicePixelRatioF()
+        pixmap = self.cached(path, size, device_pixel_ratio)
+        if pixmap is not None:
+            pixmap = QPixmap(pixmap)
+            pixmap.setDevicePixelRatio(device_pixel_ratio)
+            callback(pixmap)
+            return
+
+        request = ThumbnailRequest(
+            key=self._key(path, size, device_pixel_ratio), widget=weakref.ref(widget), callback=callback,
+            device_pixel_ratio=device_pixel_ratio)
+        self._pending[id(widget)] = request
+        if widget not in self._watched:
+            self._watched.add(widget)
+            widget.installEventFilter(self)
+        self._dispatch_timer.start()
+
+    def cancel(self, widget: QWidget):
+        """
+        Cancels the image request done for the given widget.
+
+        :param widget: widget whose request will be cancelled.
+        """
+
+        widget_id = id(widget)
+        self._pending.pop(widget_id, None)
+        self._parked.pop(widget_id, None)
+        for requests in self._in_flight.values():
+            requests[:] = [request for request in requests if request.widget() is not widget]
+
+    def clear_memory_cache(self):
+        """
+        Removes all loaded pixmaps from memory.
+        """
+
+        self._memory_cache.clear()
+
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        """
+        Overrides base eventFilter function to resume parked requests once their widget is painted again.
+
+        :param watched: watched widget.
+        :param event: Qt event.
+        :return: False, so event is always processed by the widget.
+        """
+
+        if event.type() in (QEvent.Paint, QEvent.Show):
+            request = self._parked.pop(id(watched), None)
+            if request is not None:
+                self._pending[id(watched)] = request
+                self._dispatch_timer.start()
+
+        return False
+
+    def _key(self, path: str, size: QSize, device_pixel_ratio: float) -> tuple[str, int, int]:
+        """
+        Internal function that returns the cache key of the given image.
+
+        :param path: image path.
+        :param size: image size (in logical pixels).
+        :param device_pixel_ratio: device pixel ratio the image is loaded for.
+        :return: cache key.
+        """
+
+        return (
+            os.path.normpath(path), int(round(size.width() * device_pixel_ratio)),
+            int(round(size.height() * device_pixel_ratio)))
+
+    def _cached(self, key: tuple[str, int, int]) -> QPixmap | None:
+        """
+        Internal function that returns the pixmap with the given key from the memory cache.
+
+        :param key: image key.
+        :return: cached pixmap or None if image is not loaded yet.
+        """
+
+        pixmap = self._memory_cache.get(key)
+        if pixmap is not None:
+            self._memory_cache.move_to_end(key)
+
+        return pixmap
+
+    def _dispatch(self):
+        """
+        Internal function that submits pending requests whose widget is visible on screen to the thread pool.
+        """
+
+        while self._pending and len(self._in_flight) < MAX_WORKERS * 2:
+            widget_id, request = self._pending.popitem(last=False)
+            widget = request.target()
+            if widget is None:
+                continue
+            if not widget.isVisible() or widget.visibleRegion().isEmpty():
+                self._parked[widget_id] = request
+                continue
+            pixmap = self._cached(request.key)
+            if pixmap is not None:
+                result = QPixmap(pixmap)
+                result.setDevicePixelRatio(request.device_pixel_ratio)
+                request.callback(result)
+                continue
+            requests = self._in_flight.get(request.key)
+            if requests is not None:
+                requests.append(request)
+                continue
+            self._in_flight[request.key] = [request]
+            self._executor.submit(self._load, request.key, self._disk_cache_folder)
+
+    def _load(self, key: tuple[str, int, int], disk_cache_folder: str | None):
+        """
+        Internal function that decodes and scales an image. It runs in a worker thread.
+
+        :param key: image key (path and size in device pixels).
+        :param disk_cache_folder: folder where scaled images are cached or None to skip disk cache.
+        """
+
+        path, width, height = key
+        image = QImage()
+        try:
+            cache_path = self._disk_cache_path(key, disk_cache_folder) if disk_cache_folder else ''
+            if cache_path and os.path.isfile(cache_path):
+                image = QImage(cache_path)
+            if image.isNull():
+                reader = QImageReader(path)
+                reader.setAutoTransform(True)
+                source_size = reader.size()
+                if source_size.isValid():
+                    # decoders such as JPEG can decode directly at a smaller size, which is much faster.
+                    reader.setScaledSize(source_size.scaled(width, height, Qt.KeepAspectRatio))
+                image = reader.read()
+                if not image.isNull() and (image.width() > width or image.height() > height):
+                    image = image.scaled(width, height, Qt.KeepAspectRatio, Qt.SmoothTransformation)
+                if cache_path and not image.isNull():
+                    os.makedirs(os.path.dirname(cache_path), exist_ok=True)
+                    image.save(cache_path, 'PNG')
+        except Exception:
+            logger.warning(f'Was not possible to load image: {path}', exc_info=True)
+        finally:
+            self._imageLoaded.emit(key, image)
+
+    def _disk_cache_path(self, key: tuple[str, int, int], disk_cache_folder: str) -> str:
+        """
+        Internal function that returns the disk cache path of the given image. Path depends on the source image
+        modification time, so cached images are invalidated when source image changes.
+
+        :param key: image key (path and size in device pixels).
+        :param disk_cache_folder: folder where scaled images are cached.
+        :return: absolute disk cache path or an empty string if source image does not exist.
+        """
+
+        path, width, height = key
+        try:
+            modified_time = os.path.getmtime(path)
+        except OSError:
+            return ''
+        digest = hashlib.sha1(f'{path}|{modified_time}|{width}x{height}'.encode('utf-8')).hexdigest()
+
+        return os.path.join(disk_cache_folder, digest[:2], f'{digest}.png')
+
+    def _on_image_loaded(self, key: tuple[str, int, int], image: QImage):
+        """
+        Internal callback function that is called in the UI thread each time an image is loaded.
+
+        :param key: image key.
+        :param image: loaded image.
+        """
+
+        requests = self._in_flight.pop(key, [])
+        if image.isNull():
+            self._dispatch()
+            return
+
+        # QPixmap must be created in the UI thread.
+        pixmap = QPixmap.fromImage(image)
+        self._memory_cache[key] = pixmap
+        while len(self._memory_cache) > self._memory_cache_size:
+            self._memory_cache.popitem(last=False)
+
+        for request in requests:
+            if request.target() is None:
+                continue
+            result = QPixmap(pixmap)
+            result.setDevicePixelRatio(request.device_pixel_ratio)
+            try:
+                request.callback(result)
+            except RuntimeError:
+                continue
+        self._dispatch()
+
+
+def thumbnail_loader() -> ThumbnailLoader:
+    """
+    Returns global thumbnail loader instance.
+
+    :return: thumbnail loader.
+    """
+
+    global _THUMBNAIL_LOADER
+
+    if _THUMBNAIL_LOADER is None:
+        _THUMBNAIL_LOADER = ThumbnailLoader(disk_cache_folder=cache_folder())
+
+    return _THUMBNAIL_LOADER
+
+
+def load_into_label(label: QLabel, path: str, size: QSize, on_loaded: Callable[[QPixmap], None] | None = None):
+    """
+    Shows a placeholder in the given label and loads the image asynchronously into it.
+
+    :param label: label to show image in.
+    :param path: image path.
+    :param size: image size (in logical pixels).
+    :param on_loaded: optional function called with the loaded pixmap, after it is set in the label.
+    """
+
+    loader = thumbnail_loader()
+    label_ref = weakref.ref(label)
+
+    def _on_loaded(pixmap: QPixmap):
+        target = label_ref()
+        if target is None:
+            return
+        target.setPixmap(pixmap)
+        if on_loaded is not None:
+            on_loaded(pixmap)
+
+    cached = loader.cached(path, size, label.devicePixelRatioF())
+    if cached is None:
+        label.setPixmap(loader.placeholder(size))
+    loader.request(label, path, size, _on_loaded)
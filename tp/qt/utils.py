@@ -3,7 +3,7 @@ from __future__ import annotations
 import logging
 from typing import Type, Iterator
 
-from . import dpi
+from . import dpi, refresh, query
 # noinspection PyUnresolvedReferences
 from ..externals.Qt import __binding__
 from ..externals.Qt.QtCore import Qt, QObject, QPoint, QRect
@@ -148,25 +148,36 @@ def contain_widget_in_screen(widget: QWidget, pos: QPoint | None = None) -> QPoi
     return pos
 
 
-def update_widget_style(widget: QWidget):
+def update_widget_style(widget: QWidget, immediate: bool = False):
     """
     Updates object widget style. Should be called for example when a style name changes.
+    By default, update is deferred to the refresh scheduler, so many updates of the same widget within an event loop
+    iteration only recompute its style once.
 
     :param widget: widget to update style of.
+    :param immediate: whether to update widget style right away.
     """
 
-    widget.setStyle(widget.style())
+    if immediate:
+        widget.setStyle(widget.style())
+    else:
+        refresh.refresh_scheduler().restyle(widget)
 
 
-def update_widget_sizes(widget: QWidget):
+def update_widget_sizes(widget: QWidget, immediate: bool = True):
     """
     Updates the given widget sizes.
 
     :param widget: widget to update sizes of.
+    :param immediate: whether to update widget layout right away. If False, update is deferred to the refresh
+        scheduler, so many updates of the same widget within an event loop iteration only activate its layout once.
     """
 
     if not widget:
         return
+    if not immediate:
+        refresh.refresh_scheduler().relayout(widget)
+        return
     widget_layout = widget.layout()
     if widget_layout:
         widget_layout.update()
@@ -195,17 +206,22 @@ def recursively_set_menu_actions_visibility(menu: QMenu, state: bool):
     :param state: new visibility status.
     """
 
-    for action in menu.actions():
-        sub_menu = action.menu()
-        if sub_menu:
-            recursively_set_menu_actions_visibility(sub_menu, state)
-        elif action.isSeparator():
+    # menus are visited without recursion; sub menus are processed before their parent menu, because parent menu
+    # visibility depends on the visibility of its actions.
+    stack: list[tuple[QMenu, bool]] = [(menu, False)]
+    while stack:
+        current_menu, children_processed = stack.pop()
+        if not children_processed:
+            stack.append((current_menu, True))
+            stack.extend((action.menu(), False) for action in current_menu.actions() if action.menu())
             continue
-        if action.isVisible() != state:
-            action.setVisible(state)
-
-    if any(action.isVisible() for action in menu.actions()) and menu.isVisible() != state:
-        menu.menuAction().setVisible(state)
+        for action in current_menu.actions():
+            if not action.menu() and action.isSeparator():
+                continue
+            if action.isVisible() != state:
+                action.setVisible(state)
+        if any(action.isVisible() for action in current_menu.actions()) and current_menu.isVisible() != state:
+            current_menu.menuAction().setVisible(state)
 
 
 def set_shadow_effect_enabled(widget: QWidget, flag: bool) -> QGraphicsDropShadowEffect | None:
@@ -263,24 +279,20 @@ def iterate_children(widget: QObject, skip: str | None = None, obj_class: Type |
     """
     Iterates over the children of the given widget.
 
-    This function iterates over the children of the given widget, optionally skipping children
-    with a specific object name or belonging to a specific class.
+    This function iterates over all the descendants of the given widget (without recursion), optionally skipping
+    descendants of children with a specific dynamic property and filtering them by class.
 
     :param widget: The widget whose children to iterate over.
-    :param skip: Optional. The object name of children to skip. Defaults to None.
-    :param obj_class: Optional. The class of children to include. Defaults to None.
+    :param skip: Optional. The dynamic property name of children whose descendants will be skipped. Defaults to None.
+    :param obj_class: Optional. The class of children to include. Children of other classes are not included, but
+        their descendants are. Defaults to None.
     :return: An iterator of QWidget instances representing the children.
     """
 
-    for child in widget.children():
-        yield child
-        if skip is not None and child.property(skip):
-            continue
+    for child in query.iterate_descendants(widget, skip=skip):
         if obj_class is not None and not isinstance(child, obj_class):
             continue
-        # noinspection PyTypeChecker
-        for grand_child in iterate_children(widget=child, skip=skip):
-            yield grand_child
+        yield child
 
 
 def click_under(
@@ -1,6 +1,6 @@
 from __future__ import annotations
 
-from typing import Any
+from typing import Any, Callable
 from functools import partial
 
 from ...externals.Qt.QtCore import Qt, Signal, Property, QPoint, QSize, QTimer, QEvent
@@ -12,7 +12,7 @@ from ...externals.Qt.QtGui import (
 )
 from . import menus
 from ...resources.style import theme
-from .. import dpi, icon, color, utils as qtutils
+from .. import dpi, icon, color, refresh, thumbnails, utils as qtutils
 
 
 class AbstractButton(dpi.DPIScaling):
@@ -631,17 +631,21 @@ class BaseButton(QPushButton, AbstractButton):
         found_menu = self.menu(mouse_menu, searchable=self.is_searchable(mouse_menu))
         found_menu.setTearOffEnabled(tearoff)
 
-    # def update_theme(self, event):
-    #
-    #     if not self._theme_updates_color:
-    #         return
-    #
-    #     self._icon_color_theme = self._icon_color_theme or 'BUTTON_ICON_COLOR'
-    #     if self._icon_color_theme:
-    #         icon_color = getattr(event.theme_dict, self._icon_color_theme)
-    #     else:
-    #         icon_color = event.theme_dict.BUTTON_ICON_COLOR
-    #     self.set_icon_color(icon_color)
+    def update_theme(self, event: theme.ThemeUpdateEvent):
+        """
+        Function that is called by the theme when any of the tokens this button depends on changes.
+
+        :param event: theme update event.
+        """
+
+        if not self._theme_updates_color or not self._icon_color_theme:
+            return
+        if self._icon_color_theme not in event.changed and not event.stylesheet_changed:
+            return
+
+        icon_color = event.theme_dict.get(self._icon_color_theme)
+        if icon_color:
+            self.set_icon_color(color.from_string(icon_color))
 
     def menu_pos(self, align: Qt.AlignmentFlag = Qt.AlignLeft, widget: QWidget | None = None) -> QPoint:
         """
@@ -805,9 +809,7 @@ class BaseToolButton(QToolButton):
         self._theme_size = self._theme.sizes.default
 
     def enterEvent(self, arg__1: QEvent) -> None:
-        if self._image:
-            accent_color = self._theme.primary_color
-            self.setIcon(icon.colorize_icon(self._image, color=color.from_string(accent_color)))
+        self._polish_icon()
         return super().enterEvent(arg__1)
 
     def leaveEvent(self, arg__1: QEvent) -> None:
@@ -927,18 +929,40 @@ class BaseToolButton(QToolButton):
 
         return self
 
+    def update_theme(self, event: theme.ThemeUpdateEvent):
+        """
+        Function that is called by the theme when primary color changes.
+
+        :param event: theme update event.
+        """
+
+        self._polish_icon()
+
     # noinspection PyUnusedLocal
-    def _polish_icon(self, **kwargs):
+    def _polish_icon(self, *args, **kwargs):
         """
         Internal function that polishes button icon.
+        Icon is colorized by the refresh scheduler, so toggle, hover and theme changes happening within the same event
+        loop iteration only colorize the icon once.
         """
 
         if self._image and not self._image.isNull():
+            refresh.refresh_scheduler().refresh(self, self._apply_icon)
+
+    def _apply_icon(self):
+        """
+        Internal function that sets button icon, colorized with the theme accent color if the button is checked or
+        hovered.
+        """
+
+        if not self._image or self._image.isNull():
+            return
+
+        if self.underMouse() or (self.isCheckable() and self.isChecked()):
             accent_color = self._theme.primary_color
-            if self.isCheckable() and self.isChecked():
-                self.setIcon(icon.colorize_icon(self._image, color=color.from_string(accent_color)))
-            else:
-                self.setIcon(self._image)
+            self.setIcon(icon.colorize_icon(self._image, color=color.from_string(accent_color)))
+        else:
+            self.setIcon(self._image)
 
     def _get_theme_size(self) -> int:
         """
@@ -958,7 +982,7 @@ class BaseToolButton(QToolButton):
         """
 
         self._theme_size = value
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
         if self.toolButtonStyle() == Qt.ToolButtonIconOnly:
             self.setFixedSize(self._theme_size, self._theme_size)
 
@@ -1173,7 +1197,16 @@ class ShadowedButtonImage(QLabel, dpi.DPIScaling):
     stylesheet purposes
     """
 
-    pass
+    def set_image(self, path: str, size: QSize | None = None, on_loaded: Callable[[QPixmap], None] | None = None):
+        """
+        Loads given image asynchronously. A placeholder is shown until image is loaded.
+
+        :param path: image path.
+        :param size: optional image size. If not given, current widget size is used.
+        :param on_loaded: optional function called with the loaded pixmap.
+        """
+
+        thumbnails.load_into_label(self, path, size or self.size(), on_loaded=on_loaded)
 
 
 class ShadowedButtonShadow(QFrame, dpi.DPIScaling):
@@ -1283,10 +1316,6 @@ class ShadowedButton(BaseButton):
         event.ignore()
         return super().mouseDoubleClickEvent(event)
 
-    # def update_theme(self, event):
-    #     if self._theme_updates_color:
-    #         self._icon_color_theme = self._icon_color_theme or '$BUTTON_ICON_COLOR'
-
     def setup_ui(self):
         """
         Initializes shadow button UI.
@@ -1371,6 +1400,22 @@ class ShadowedButton(BaseButton):
 
         self._image_widget.setPixmap(self._icon_pixmap)
 
+    def set_image(self, path: str, size: int | None = None):
+        """
+        Sets button image from an image file (e.g: an asset thumbnail). Image is loaded asynchronously and a
+        placeholder is shown until it is loaded.
+
+        :param path: image path.
+        :param size: optional image size.
+        """
+
+        if size is not None:
+            self.setIconSize(QSize(size, size))
+
+        self._icon_names = []
+        self._image_widget.set_image(path, self._icon_size, on_loaded=self._on_image_loaded)
+        self._icon_pixmap = self._icon_hovered_pixmap = self._icon_pressed_pixmap = self._image_widget.pixmap()
+
     def update_image_widget(self, new_height: int):
         """
         Updates button to make sure widget is always square.
@@ -1381,6 +1426,15 @@ class ShadowedButton(BaseButton):
         self._image_widget.setFixedSize(QSize(new_height, new_height))
         self._spacing_widget.setFixedWidth(int(dpi.dpi_scale(new_height) * 0.5))
 
+    def _on_image_loaded(self, pixmap: QPixmap):
+        """
+        Internal callback function that is called when button image is loaded.
+
+        :param pixmap: loaded image pixmap.
+        """
+
+        self._icon_pixmap = self._icon_hovered_pixmap = self._icon_pressed_pixmap = pixmap
+
 
 class LeftAlignedButton(QPushButton):
     """
@@ -2,11 +2,11 @@ from __future__ import annotations
 
 from typing import Sequence, Iterator, Any
 
-from ...externals.Qt.QtCore import Qt, Signal
-from ...externals.Qt.QtWidgets import QSizePolicy, QWidget, QLabel, QComboBox, QHBoxLayout
+from ...externals.Qt.QtCore import Qt, Signal, QObject, QTimer, QModelIndex, QAbstractListModel, QStringListModel
+from ...externals.Qt.QtWidgets import QSizePolicy, QWidget, QLabel, QComboBox, QHBoxLayout, QCompleter, QListView
 from ...externals.Qt.QtGui import QIcon, QKeyEvent, QWheelEvent
 from .. import uiconsts, dpi
-from . import layouts, labels
+from . import layouts, labels, search
 
 
 class BaseComboBox(QComboBox):
@@ -518,6 +518,12 @@ class ComboBoxRegularWidget(ComboBoxAbstractWidget):
 
 
 class ComboBoxSearchable(ComboBoxAbstractWidget):
+    """
+    Combo box widget whose items can be fuzzy searched by typing. Items texts are indexed once and the index is
+    updated when items change, while typed text is debounced and matched without blocking the UI.
+    """
+
+    MAX_COMPLETIONS = 50
 
     # noinspection SpellCheckingInspection
     def __init__(
@@ -563,4 +569,750 @@ class ComboBoxSearchable(ComboBoxAbstractWidget):
         else:
             main_layout.addWidget(self._box)
 
+        self._search_controller = search.FuzzySearchController(limit=self.MAX_COMPLETIONS, parent=self)
+        self._completer_model = QStringListModel(parent=self)
+        self._completer = QCompleter(self._completer_model, self)
+        self._completer.setCompletionMode(QCompleter.UnfilteredPopupCompletion)
+        self._completer.setCaseSensitivity(Qt.CaseInsensitive)
+        self._box.setCompleter(self._completer)
+        self._debounce_timer = QTimer(parent=self)
+        self._debounce_timer.setSingleShot(True)
+        self._debounce_timer.setInterval(search.SearchFindWidget.DEFAULT_DEBOUNCE_INTERVAL)
+        self._rebuild_search_index()
+
         self._box.currentIndexChanged.connect(self.on_item_changed)
+        self._box.lineEdit().textEdited.connect(self._on_text_edited)
+        self._debounce_timer.timeout.connect(self._on_debounce_timer_timeout)
+        self._search_controller.resultsReady.connect(self._on_search_results_ready)
+        self._completer.activated[str].connect(self._on_completer_activated)
+        model = self._box.model()
+        model.rowsInserted.connect(self._on_rows_inserted)
+        model.rowsRemoved.connect(self._rebuild_search_index)
+        model.rowsMoved.connect(self._rebuild_search_index)
+        model.modelReset.connect(self._rebuild_search_index)
+        model.dataChanged.connect(self._on_data_changed)
+
+    def _rebuild_search_index(self, *args):
+        """
+        Internal function that indexes again all combo box item texts.
+        """
+
+        index = self._search_controller.index
+        index.clear()
+        for row in range(self._box.count()):
+            index.add(row, [self._box.itemText(row)])
+
+    def _on_rows_inserted(self, parent: QModelIndex, first: int, last: int):
+        """
+        Internal callback function that is called when new items are added into the combo box.
+
+        :param parent: parent model index.
+        :param first: first inserted row.
+        :param last: last inserted row.
+        """
+
+        if last != self._box.count() - 1:
+            # Rows were inserted in the middle, so indexed rows are not valid anymore.
+            self._rebuild_search_index()
+            return
+
+        index = self._search_controller.index
+        for row in range(first, last + 1):
+            index.add(row, [self._box.itemText(row)])
+
+    def _on_data_changed(self, top_left: QModelIndex, bottom_right: QModelIndex, *args):
+        """
+        Internal callback function that is called when combo box items data changes.
+
+        :param top_left: top left changed model index.
+        :param bottom_right: bottom right changed model index.
+        """
+
+        index = self._search_controller.index
+        for row in range(top_left.row(), bottom_right.row() + 1):
+            index.update(row, [self._box.itemText(row)])
+
+    def _on_text_edited(self, text: str):
+        """
+        Internal callback function that is called each time user types within the combo box.
+
+        :param text: typed text.
+        """
+
+        if text:
+            self._debounce_timer.start()
+        else:
+            self._debounce_timer.stop()
+            self._search_controller.cancel()
+
+    def _on_debounce_timer_timeout(self):
+        """
+        Internal callback function that is called when user stopped typing for the debounce interval.
+        """
+
+        self._search_controller.search(self._box.lineEdit().text())
+
+    def _on_search_results_ready(self, query: str, results: list[tuple[int, int]]):
+        """
+        Internal callback function that is called when a search finishes.
+
+        :param query: search query.
+        :param results: matched rows and their scores.
+        """
+
+        if query != self._box.lineEdit().text():
+            return
+
+        self._completer_model.setStringList([self._box.itemText(row) for row, _ in results])
+        if results:
+            self._completer.complete()
+
+    def _on_completer_activated(self, text: str):
+        """
+        Internal callback function that is called when user selects a completion.
+
+        :param text: selected item text.
+        """
+
+        self.set_to_text(text)
+
+
+def _flag_value(flag: Qt.MatchFlags | int) -> int:
+    """
+    Internal function that returns the integer value of the given Qt flag.
+
+    :param flag: Qt flag.
+    :return: flag value.
+    """
+
+    return int(getattr(flag, 'value', flag))
+
+
+class VirtualListModel(QAbstractListModel):
+    """
+    List model that stores a big number of items but only exposes them to views in batches, as views request them
+    through `fetchMore`. Items can be filtered within the model, without creating a proxy model.
+    """
+
+    FETCH_BATCH_SIZE = 256
+
+    def __init__(self, parent: QObject | None = None):
+        super().__init__(parent)
+
+        self._texts: list[str] = []
+        self._lowered_texts: list[str] = []
+        self._data: list[Any] = []
+        self._filter_text = ''
+        self._rows: list[int] | None = None
+        self._fetched = 0
+
+    def rowCount(self, parent: QModelIndex = QModelIndex()) -> int:
+        return 0 if parent.isValid() else self._fetched
+
+    def data(self, index: QModelIndex, role: Qt.ItemDataRole = Qt.DisplayRole) -> Any:
+        if not index.isValid() or index.row() >= self._fetched:
+            return None
+
+        source_row = self.source_row(index.row())
+        if role in (Qt.DisplayRole, Qt.EditRole, Qt.ToolTipRole):
+            return self._texts[source_row]
+        elif role == Qt.UserRole:
+            return self._data[source_row]
+
+        return None
+
+    def setData(self, index: QModelIndex, value: Any, role: Qt.ItemDataRole = Qt.EditRole) -> bool:
+        if not index.isValid() or index.row() >= self._fetched:
+            return False
+
+        source_row = self.source_row(index.row())
+        if role in (Qt.DisplayRole, Qt.EditRole):
+            self._texts[source_row] = str(value)
+            self._lowered_texts[source_row] = str(value).lower()
+        elif role == Qt.UserRole:
+            self._data[source_row] = value
+        else:
+            return False
+        self.dataChanged.emit(index, index, [role])
+
+        return True
+
+    def canFetchMore(self, parent: QModelIndex = QModelIndex()) -> bool:
+        return not parent.isValid() and self._fetched < self.filtered_count()
+
+    def fetchMore(self, parent: QModelIndex = QModelIndex()):
+        if parent.isValid():
+            return
+
+        self.fetch_until(self._fetched + self.FETCH_BATCH_SIZE - 1)
+
+    def total_count(self) -> int:
+        """
+        Returns the total number of items stored within the model, ignoring the filter.
+
+        :return: items count.
+        """
+
+        return len(self._texts)
+
+    def filtered_count(self) -> int:
+        """
+        Returns the number of items that pass the filter, fetched or not.
+
+        :return: filtered items count.
+        """
+
+        return len(self._texts) if self._rows is None else len(self._rows)
+
+    def source_row(self, row: int) -> int:
+        """
+        Returns the index within all the stored items of the item at the given filtered row.
+
+        :param row: filtered row.
+        :return: source row.
+        """
+
+        return row if self._rows is None else self._rows[row]
+
+    def filtered_row(self, source_row: int) -> int:
+        """
+        Returns the filtered row of the item stored at given source row.
+
+        :param source_row: source row.
+        :return: filtered row or -1 if item does not pass the filter.
+        """
+
+        if self._rows is None:
+            return source_row if 0 <= source_row < len(self._texts) else -1
+        try:
+            return self._rows.index(source_row)
+        except ValueError:
+            return -1
+
+    def fetch_until(self, row: int):
+        """
+        Fetches all the items up to the given filtered row, within a single rows insertion.
+
+        :param row: filtered row.
+        """
+
+        last = min(row, self.filtered_count() - 1)
+        if last < self._fetched:
+            return
+
+        self.beginInsertRows(QModelIndex(), self._fetched, last)
+        self._fetched = last + 1
+        self.endInsertRows()
+
+    def text(self, source_row: int) -> str:
+        """
+        Returns the text of the item stored at given source row.
+
+        :param source_row: source row.
+        :return: item text or an empty string if row is not valid.
+        """
+
+        return self._texts[source_row] if 0 <= source_row < len(self._texts) else ''
+
+    def texts(self) -> list[str]:
+        """
+        Returns the texts of all stored items.
+
+        :return: item texts.
+        """
+
+        return list(self._texts)
+
+    def item_data(self, source_row: int) -> Any:
+        """
+        Returns the data of the item stored at given source row.
+
+        :param source_row: source row.
+        :return: item data or None if row is not valid.
+        """
+
+        return self._data[source_row] if 0 <= source_row < len(self._data) else None
+
+    def set_item(self, source_row: int, text: str | None = None, data: Any = ...):
+        """
+        Updates the text and/or the data of the item stored at given source row.
+
+        :param source_row: source row.
+        :param text: optional new item text.
+        :param data: optional new item data.
+        """
+
+        if text is not None:
+            self._texts[source_row] = str(text)
+            self._lowered_texts[source_row] = str(text).lower()
+        if data is not ...:
+            self._data[source_row] = data
+        row = self.filtered_row(source_row)
+        if 0 <= row < self._fetched:
+            self.dataChanged.emit(self.index(row), self.index(row))
+
+    def set_items(self, texts: Sequence[str], data: Sequence[Any] | None = None, sort_alphabetically: bool = False):
+        """
+        Replaces all stored items.
+
+        :param texts: item texts.
+        :param data: optional item data, one per item text.
+        :param sort_alphabetically: whether to sort items alphabetically.
+        """
+
+        items = list(zip([str(text) for text in texts], data if data is not None else [None] * len(texts)))
+        if sort_alphabetically:
+            items.sort(key=lambda item: item[0].lower())
+
+        self.beginResetModel()
+        self._texts = [item[0] for item in items]
+        self._lowered_texts = [text.lower() for text in self._texts]
+        self._data = [item[1] for item in items]
+        self._rows = self._filter_rows(self._filter_text)
+        self._fetched = min(self.FETCH_BATCH_SIZE, self.filtered_count())
+        self.endResetModel()
+
+    def add_items(self, texts: Sequence[str], data: Sequence[Any] | None = None, sort_alphabetically: bool = False):
+        """
+        Adds given items. Items are only exposed to the views when they fetch them.
+
+        :param texts: item texts.
+        :param data: optional item data, one per item text.
+        :param sort_alphabetically: whether to sort all items alphabetically after adding the new ones.
+        """
+
+        if sort_alphabetically:
+            self.set_items(
+                self._texts + [str(text) for text in texts],
+                self._data + (list(data) if data is not None else [None] * len(texts)), sort_alphabetically=True)
+            return
+
+        first_source_row = len(self._texts)
+        self._texts.extend(str(text) for text in texts)
+        self._lowered_texts.extend(text.lower() for text in self._texts[first_source_row:])
+        self._data.extend(data if data is not None else [None] * len(texts))
+        if self._rows is not None:
+            self._rows.extend(
+                i for i in range(first_source_row, len(self._texts)) if self._filter_text in self._lowered_texts[i])
+
+    def remove_item(self, source_row: int):
+        """
+        Removes the item stored at given source row.
+
+        :param source_row: source row.
+        """
+
+        row = self.filtered_row(source_row)
+        fetched = 0 <= row < self._fetched
+        if fetched:
+            self.beginRemoveRows(QModelIndex(), row, row)
+        del self._texts[source_row]
+        del self._lowered_texts[source_row]
+        del self._data[source_row]
+        if self._rows is not None:
+            self._rows = [i - 1 if i > source_row else i for i in self._rows if i != source_row]
+        if fetched:
+            self._fetched -= 1
+            self.endRemoveRows()
+
+    def clear(self):
+        """
+        Removes all stored items.
+        """
+
+        self.set_items([])
+
+    def find_text(self, text: str, flags: Qt.MatchFlags = Qt.MatchFixedString) -> int:
+        """
+        Returns the source row of the first item matching given text, fetched or not.
+
+        :param text: text to search.
+        :param flags: match flags. Only fixed string, starts with and contains matches are supported.
+        :return: source row or -1 if no item matches given text.
+        """
+
+        flags = _flag_value(flags)
+        case_sensitive = bool(flags & _flag_value(Qt.MatchCaseSensitive))
+        texts = self._texts if case_sensitive else self._lowered_texts
+        text = text if case_sensitive else text.lower()
+        match_type = flags & 0x0F
+        for i, item_text in enumerate(texts):
+            if match_type == _flag_value(Qt.MatchContains):
+                if text in item_text:
+                    return i
+            elif match_type == _flag_value(Qt.MatchStartsWith):
+                if item_text.startswith(text):
+                    return i
+            elif item_text == text:
+                return i
+
+        return -1
+
+    def filter_text(self) -> str:
+        """
+        Returns current filter text.
+
+        :return: filter text.
+        """
+
+        return self._filter_text
+
+    def set_filter_text(self, text: str):
+        """
+        Sets the filter text. Only items containing given text (case-insensitive) are exposed to the views.
+
+        :param text: filter text. Empty string to disable filtering.
+        """
+
+        text = str(text or '').lower()
+        if text == self._filter_text:
+            return
+
+        self.beginResetModel()
+        self._filter_text = text
+        self._rows = self._filter_rows(text)
+        self._fetched = min(self.FETCH_BATCH_SIZE, self.filtered_count())
+        self.endResetModel()
+
+    def _filter_rows(self, text: str) -> list[int] | None:
+        """
+        Internal function that returns the source rows of the items that contain the given text.
+
+        :param text: lowercase filter text.
+        :return: filtered source rows or None if there is no filter.
+        """
+
+        if not text:
+            return None
+
+        return [i for i, lowered_text in enumerate(self._lowered_texts) if text in lowered_text]
+
+
+class VirtualComboBox(QComboBox):
+    """
+    Combo box backed by a `VirtualListModel`. Popup only creates the items the user scrolls to and, when editable,
+    typed text filters the model.
+    """
+
+    def __init__(self, parent: QWidget | None = None):
+        super().__init__(parent)
+
+        self._model = VirtualListModel(parent=self)
+        view = QListView(self)
+        view.setUniformItemSizes(True)
+        view.setLayoutMode(QListView.Batched)
+        view.setBatchSize(VirtualListModel.FETCH_BATCH_SIZE)
+        self.setView(view)
+        self.setModel(self._model)
+
+        self._filter_timer = QTimer(parent=self)
+        self._filter_timer.setSingleShot(True)
+        self._filter_timer.setInterval(search.SearchFindWidget.DEFAULT_DEBOUNCE_INTERVAL)
+        self._filter_timer.timeout.connect(self._on_filter_timer_timeout)
+        # source row of the current item while it is hidden by the filter.
+        self._filtered_out_source_row = -1
+
+    @property
+    def virtual_model(self) -> VirtualListModel:
+        """
+        Returns combo box model.
+
+        :return: virtual list model.
+        """
+
+        return self._model
+
+    def setEditable(self, editable: bool):
+        """
+        Overrides base setEditable function to filter the model with the typed text.
+
+        :param editable: whether combo box is editable.
+        """
+
+        super().setEditable(editable)
+        if editable:
+            # Qt completer would iterate the whole model, so filtering is done by the model itself.
+            self.setCompleter(None)
+            self.lineEdit().textEdited.connect(self._filter_timer.start)
+
+    def set_current_source_row(self, source_row: int):
+        """
+        Sets current item from its source row, fetching it if necessary. If item does not pass the current filter,
+        filter is cleared.
+
+        :param source_row: source row.
+        """
+
+        row = self._model.filtered_row(source_row)
+        if row < 0 and self._model.filter_text():
+            self._model.set_filter_text('')
+            row = self._model.filtered_row(source_row)
+        if row < 0:
+            return
+
+        self._filtered_out_source_row = -1
+        self._model.fetch_until(row)
+        self.setCurrentIndex(row)
+
+    def current_source_row(self) -> int:
+        """
+        Returns the source row of the current item.
+
+        :return: source row or -1 if there is no current item.
+        """
+
+        row = self.currentIndex()
+        return self._model.source_row(row) if row >= 0 else self._filtered_out_source_row
+
+    def _on_filter_timer_timeout(self):
+        """
+        Internal callback function that filters the model with the text typed by the user.
+        """
+
+        line_edit = self.lineEdit()
+        text = line_edit.text()
+        cursor_position = line_edit.cursorPosition()
+        selection_start = line_edit.selectionStart()
+        selection_length = len(line_edit.selectedText())
+        current_source_row = self.current_source_row()
+
+        # filtering does not change the current item, so model reset index changes are not notified. If the current
+        # item is filtered out, it is still reported as the current one until the user picks another item.
+        self.blockSignals(True)
+        try:
+            self._model.set_filter_text(text)
+            row = self._model.filtered_row(current_source_row) if current_source_row >= 0 else -1
+            if row >= 0:
+                self._model.fetch_until(row)
+                self.setCurrentIndex(row)
+                self._filtered_out_source_row = -1
+            else:
+                self._filtered_out_source_row = current_source_row
+        finally:
+            self.blockSignals(False)
+
+        # model reset replaces line edit text with the current item one.
+        line_edit.setText(text)
+        if selection_start >= 0 and selection_length:
+            line_edit.setSelection(selection_start, selection_length)
+        else:
+            line_edit.setCursorPosition(cursor_position)
+        if text:
+            self.showPopup()
+
+
+class ComboBoxVirtualWidget(ComboBoxAbstractWidget):
+    """
+    Combo box widget that can hold a very big number of items (e.g: all scene node names). Items are stored within a
+    lazily fetched model, so only the items the user scrolls to are created by the popup.
+    """
+
+    def __init__(
+            self, label: str = '', items: Sequence[str] | None = None, label_ratio: int | None = None,
+            box_ratio: int | None = None, tooltip: str = '', set_index: int = 0, sort_alphabetically: bool = False,
+            item_data: Sequence[Any] | None = None, editable: bool = True, parent: QWidget | None = None):
+        """
+        Initializes the ComboBoxVirtualWidget.
+
+        :param label: The text for the label. Defaults to an empty string.
+        :param items: The items to be added to the combo box. Defaults to None.
+        :param label_ratio: The ratio of the label width. Defaults to None.
+        :param box_ratio: The ratio of the box width. Defaults to None.
+        :param tooltip: The tooltip text for the combo box. Defaults to an empty string.
+        :param set_index: The index to be set as selected. Defaults to 0.
+        :param sort_alphabetically: If True, sorts the items alphabetically. Defaults to False.
+        :param item_data: The data associated with the items. Defaults to None.
+        :param editable: If True, typed text filters the combo box items. Defaults to True.
+        :param parent: The parent widget. Defaults to None.
+        """
+
+        super().__init__(parent=parent)
+
+        main_layout = layouts.HorizontalLayout()
+        main_layout.setContentsMargins(0, 0, 0, 0)
+        self.setLayout(main_layout)
+
+        self._box = VirtualComboBox(parent=self)
+        self._box.setEditable(editable)
+        self._box.setToolTip(tooltip)
+        if items:
+            self._box.virtual_model.set_items(items, item_data, sort_alphabetically=sort_alphabetically)
+        if set_index:
+            self.set_index(set_index)
+
+        if label:
+            self._label = labels.BaseLabel(text=label, tooltip=tooltip, parent=self)
+            if label_ratio:
+                main_layout.addWidget(self._label, label_ratio)
+            else:
+                main_layout.addWidget(self._label)
+        if box_ratio:
+            main_layout.addWidget(self._box, box_ratio)
+        else:
+            main_layout.addWidget(self._box)
+
+        self._box.currentIndexChanged.connect(self.on_item_changed)
+
+    def count(self) -> int:
+        """
+        Overrides base count function to return the total number of items, fetched or not.
+
+        :return: combobox items count.
+        """
+
+        return self._box.virtual_model.total_count()
+
+    def add_item(self, item: str, sort_alphabetically: bool = False, user_data: Any = None):
+        """
+        Overrides base add_item function to add the item into the virtual model.
+
+        :param item: name to add to the combo box.
+        :param sort_alphabetically: whether to sort the full combo box alphabetically after adding the item.
+        :param user_data: optional user data to set.
+        """
+
+        self._box.virtual_model.add_items([item], [user_data], sort_alphabetically=sort_alphabetically)
+
+    def add_items(self, items: Sequence[str], sort_alphabetically: bool = False, item_data: Sequence[Any] | None = None):
+        """
+        Overrides base add_items function to add all the items into the virtual model at once.
+
+        :param items: names to add to the combo box.
+        :param sort_alphabetically: whether to sort the full combo box alphabetically after adding the items.
+        :param item_data: optional data associated with the items.
+        """
+
+        self._box.virtual_model.add_items(items, item_data, sort_alphabetically=sort_alphabetically)
+
+    def clear(self):
+        """
+        Overrides base clear function to clear the virtual model.
+        """
+
+        self._box.virtual_model.clear()
+
+    def set_index(self, index: int, quiet: bool = False):
+        """
+        Overrides base set_index function to fetch the item if necessary.
+
+        :param index: source index to set.
+        :param quiet: whether combo box should emit signals.
+        """
+
+        if quiet:
+            self._box.blockSignals(True)
+        try:
+            self._box.set_current_source_row(index or 0)
+        finally:
+            if quiet:
+                self._box.blockSignals(False)
+
+    def current_index(self) -> int:
+        """
+        Overrides base current_index function to return the source index of the current item.
+
+        :return: item index.
+        """
+
+        return self._box.current_source_row()
+
+    def item_text(self, index: int) -> str:
+        """
+        Overrides base item_text function to return the text of items that are not fetched yet.
+
+        :param index: source index of the item.
+        :return: item text.
+        """
+
+        return self._box.virtual_model.text(index)
+
+    def iterate_item_texts(self) -> Iterator[str]:
+        """
+        Overrides base iterate_item_texts function to iterate all the item texts, fetched or not.
+
+        :return: iterated item texts.
+        """
+
+        for text in self._box.virtual_model.texts():
+            yield text
+
+    def set_item_text(self, index: int, text: str):
+        """
+        Overrides base set_item_text function to update items that are not fetched yet.
+
+        :param index: source index of the item.
+        :param text: item text.
+        """
+
+        self._box.virtual_model.set_item(index, text=text)
+
+    def set_to_text(self, text: str, flags: Qt.MatchFlags = Qt.MatchFixedString, quiet: bool = False):
+        """
+        Overrides base set_to_text function to search within all the items, fetched or not.
+
+        :param text: text to search and switch the combo box to.
+        :param Qt.MatchFlags flags: optional match flags.
+        :param quiet: whether to block signals before setting text.
+        """
+
+        index = self._box.virtual_model.find_text(text, flags)
+        if index >= 0:
+            self.set_index(index, quiet=quiet)
+
+    def remove_item_by_text(self, text: str, flags: Qt.MatchFlags = Qt.MatchFixedString):
+        """
+        Overrides base remove_item_by_text function to search within all the items, fetched or not.
+
+        :param text: text to search and delete based on given flags.
+        :param flags: optional match flags.
+        """
+
+        index = self._box.virtual_model.find_text(text, flags)
+        if index >= 0:
+            self._box.virtual_model.remove_item(index)
+
+    def item_data(self, index: int, role: Qt.ItemDataRole = Qt.UserRole) -> Any:
+        """
+        Overrides base item_data function to return the data of items that are not fetched yet.
+
+        :param index: source index of the item.
+        :param role: role of the data to get.
+        :return: item data.
+        """
+
+        if role == Qt.UserRole:
+            return self._box.virtual_model.item_data(index)
+
+        return self._box.virtual_model.text(index) if role in (Qt.DisplayRole, Qt.EditRole) else None
+
+    def iterate_item_data(self) -> Iterator[Any]:
+        """
+        Overrides base iterate_item_data function to iterate the data of all the items, fetched or not.
+
+        :return: iterated data.
+        """
+
+        model = self._box.virtual_model
+        for i in range(model.total_count()):
+            yield model.item_data(i)
+
+    def set_item_data(self, index: int, value: Any):
+        """
+        Overrides base set_item_data function to update items that are not fetched yet.
+
+        :param index: source index of the item.
+        :param value: data to assign.
+        """
+
+        self._box.virtual_model.set_item(index, data=value)
+
+    def on_item_changed(self):
+        """
+        Overrides base on_item_changed function to emit source indices, which do not depend on current filter.
+        """
+
+        current_index = self._box.current_source_row()
+        event = ComboBoxAbstractWidget.ComboItemChangedEvent(
+            int(self.PREV_INDEX if self.PREV_INDEX is not None else -1), current_index, parent=self)
+        self.itemChanged.emit(event)
+        self.PREV_INDEX = current_index
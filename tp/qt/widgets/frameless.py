@@ -1,27 +1,27 @@
 from __future__ import annotations
 
 import uuid
+import asyncio
 import enum
 import weakref
 import logging
+import warnings
 import platform
 import webbrowser
-from typing import Type
+from typing import Type, Coroutine
 
-from ... import dcc
+from ... import dcc, resources
 from ...dcc import ui
-from ...python import paths
 from ...resources.style import theme
-from ...qt import dpi, utils, icon, uiconsts, factory
-from ...qt.widgets import layouts, labels, buttons, overlay
-from ...externals.Qt.QtCore import Qt, QObject, Signal, QPoint, QSize, QTimer, QEvent, QSettings
+from ...qt import dpi, utils, icon, uiconsts, factory, settings, asyncloop, paintprofiler
+from ...qt.widgets import layouts, labels, buttons
+from ...externals.Qt.QtCore import Qt, QObject, Signal, QPoint, QSize, QRect, QTimer, QEvent
 from ...externals.Qt.QtWidgets import (
     QSizePolicy, QApplication, QMainWindow, QWidget, QFrame, QToolButton, QSpacerItem, QSplitter, QTabWidget,
-    QLayout, QVBoxLayout, QHBoxLayout, QGridLayout
+    QAction, QLayout, QVBoxLayout, QHBoxLayout, QGridLayout
 )
 from ...externals.Qt.QtGui import (
-    QCursor, QColor, QIcon, QPainter, QResizeEvent, QShowEvent, QMouseEvent, QKeyEvent, QMoveEvent, QCloseEvent,
-    QPaintEvent
+    QCursor, QColor, QPainter, QResizeEvent, QShowEvent, QMouseEvent, QMoveEvent, QCloseEvent
 )
 
 if dcc.is_maya():
@@ -247,7 +247,7 @@ class DockingContainer(DockableMixin, QWidget, ContainerWidget):
         self.setLayout(ui_layout)
         # noinspection SpellCheckingInspection
         self._logo_icon.setIcon(
-            icon.colorize_icon(QIcon(paths.canonical_path('../../resources/icons/tpdcc.png')), size=size))
+            icon.colorize_icon(resources.icon('tpdcc'), size=size))
         self._logo_icon.setIconSize(dpi.size_by_dpi(QSize(size, size)))
         self._logo_icon.clicked.connect(self.close)
         self._win = self.window()
@@ -456,7 +456,7 @@ class FramelessWindow(QWidget):
         :param modal: Whether the window is modal. Defaults to False.
         :param init_pos: The initial position of the window as a tuple (x, y). Defaults to None.
         :param title_bar_class: The class used for the title bar of the window. Defaults to None.
-        :param as_overlay: Whether the window is displayed as an overlay. Defaults to True.
+        :param as_overlay: Whether window can be moved and resized using the Alt modifier. Defaults to True.
         :param always_show_all_title: Whether to always show the entire title. Defaults to False.
         :param on_top: Whether the window is always on top. Defaults to False.
         :param save_window_pref: Whether to save window preferences. Defaults to False.
@@ -479,8 +479,7 @@ class FramelessWindow(QWidget):
         self._title = title
         self._on_top = on_top
         self._minimized = False
-        self._settings = QSettings(
-            QSettings.IniFormat, QSettings.UserScope, self.WINDOW_SETTINGS_PATH, name or self.__class__.__name__)
+        self._settings_group = f'{self.WINDOW_SETTINGS_PATH}/{name or self.__class__.__name__}'
         self._save_window_pref = save_window_pref
         self._parent_container: DockingContainer | FramelessWindowContainer | None = None
         self._window_resizer: WindowResizer | None = None
@@ -491,9 +490,10 @@ class FramelessWindow(QWidget):
         self._init_height = height
         self._always_show_all_title = always_show_all_title
         self._saved_size = QSize()
-        self._filter = FramelessKeyboardModifierFilter()
+        self._as_overlay = as_overlay
         self._init_pos = init_pos
         self._main_contents: FramelessWindowContents | None = None
+        self._paint_profiler: paintprofiler.PaintProfiler | None = None
 
         title_bar_class = title_bar_class or FramelessTitleBar
         self._title_bar = title_bar_class(always_show_all=always_show_all_title, parent=self)
@@ -504,16 +504,6 @@ class FramelessWindow(QWidget):
         self.set_resizable(resizable)
         self._prev_style = self.title_style()
 
-        self._overlay = None
-        if as_overlay:
-            self._overlay = FramelessOverlay(
-                parent=self, title_bar=self._title_bar, top_left=self._window_resizer.top_left_resizer,
-                top_right=self._window_resizer.top_right_resizer, bottom_left=self._window_resizer.bottom_right_resizer,
-                bottom_right=self._window_resizer.bottom_right_resizer, resizable=resizable)
-            self._overlay.widgetMousePress.connect(self.mousePressEvent)
-            self._overlay.widgetMouseMove.connect(self.mouseMoveEvent)
-            self._overlay.widgetMouseRelease.connect(self.mouseReleaseEvent)
-
         if not minimize_button:
             self.set_minimize_button_visible(False)
 
@@ -528,9 +518,6 @@ class FramelessWindow(QWidget):
 
         self.load_settings()
 
-        self._filter.modifierPressed.connect(self.show_overlay)
-        self.installEventFilter(self._filter)
-
     @classmethod
     def frameless_window(cls, widget: QWidget) -> FramelessWindow | None:
         """
@@ -554,10 +541,11 @@ class FramelessWindow(QWidget):
         Deletes all frameless window instances.
         """
 
-        for instance in cls._INSTANCES:
-            logger.info(f'Deleting {instance}')
+        # iterate over a copy, otherwise every other instance is skipped and dead proxies pile up.
+        for instance in list(cls._INSTANCES):
             # noinspection PyBroadException
             try:
+                logger.info(f'Deleting {instance}')
                 instance.setParent(None)
                 instance.deleteLater()
             except Exception:
@@ -575,6 +563,16 @@ class FramelessWindow(QWidget):
 
         return self._title_bar
 
+    @property
+    def window_resizer(self) -> WindowResizer:
+        """
+        Getter method that returns window resizer instance for this window.
+
+        :return: frameless window resizer.
+        """
+
+        return self._window_resizer
+
     @property
     def name(self) -> str:
         """
@@ -729,6 +727,9 @@ class FramelessWindow(QWidget):
 
         self.hide()
         self.beginClosing.emit()
+        asyncloop.cancel_tasks(self)
+        if self._paint_profiler is not None:
+            self._paint_profiler.set_enabled(False)
         QApplication.processEvents()
 
         # self.save_settings()
@@ -741,46 +742,64 @@ class FramelessWindow(QWidget):
 
         return result
 
-    def keyPressEvent(self, event: QKeyEvent) -> None:
+    def load_settings(self):
         """
-        Overrides key press event function.
+        Load window settings from the shared settings store. If settings files are still being loaded by the store
+        background thread, settings are applied once they are loaded, so the UI thread never waits for disk access.
         """
 
-        if self._overlay and event.modifiers() == Qt.AltModifier:
-            self._overlay.show()
+        store = settings.settings_store()
+        if store.is_loaded():
+            self._apply_settings(store.group(self._settings_group))
+            return
 
-        return super().keyPressEvent(event)
+        window_ref = weakref.ref(self)
 
-    def load_settings(self):
+        def _on_settings_loaded():
+            window = window_ref()
+            if window is not None:
+                window._apply_settings(store.group(window._settings_group))
+
+        store.when_loaded(_on_settings_loaded)
+
+    def save_settings(self):
         """
-        Load settings located within window settings file path (if it exists).
+        Saves window settings into the shared settings store. Settings are written to disk in a background thread.
+        """
+
+        if not self.is_docked() and self._parent_container:
+            window_settings = {
+                'geometry': self._parent_container.saveGeometry(),
+                'saveState': self._parent_container.saveState(),
+                'maximized': self._parent_container.isMaximized()
+            }
+            if not self._parent_container.isMaximized():
+                window_settings['pos'] = self._parent_container.pos()
+                window_settings['size'] = self._parent_container.size()
+            settings.settings_store().update(self._settings_group, window_settings)
+
+    def _apply_settings(self, window_settings: dict):
+        """
+        Internal function that applies given window settings.
+
+        :param window_settings: window settings loaded from the settings store.
         """
 
         position = QPoint(*(self._init_pos or ()))
-        init_pos = position or self._settings.value('pos')
+        init_pos = position or window_settings.get('pos')
         self._init_pos = init_pos
 
         if not self.is_docked() and self._parent_container:
             self._parent_container.restoreGeometry(
-                self._settings.value('geometry', self._parent_container.saveGeometry()))
-            self._parent_container.restoreState(self._settings.value('saveState', self._parent_container.saveState()))
-            if self._settings.value('maximized', self._parent_container.isMaximized()):
+                window_settings.get('geometry', self._parent_container.saveGeometry()))
+            self._parent_container.restoreState(window_settings.get('saveState', self._parent_container.saveState()))
+            if window_settings.get('maximized', self._parent_container.isMaximized()):
                 self._parent_container.showMaximized()
             else:
-                self._parent_container.resize(self._settings.value('size', self._parent_container.size()))
-
-    def save_settings(self):
-        """
-        Saves settings into window settings file path.
-        """
-
-        if not self.is_docked() and self._parent_container:
-            self._settings.setValue('geometry', self._parent_container.saveGeometry())
-            self._settings.setValue('saveState', self._parent_container.saveState())
-            self._settings.setValue('maximized', self._parent_container.isMaximized())
-            if not self._parent_container.isMaximized():
-                self._settings.setValue('pos', self._parent_container.pos())
-                self._settings.setValue('size', self._parent_container.size())
+                self._parent_container.resize(window_settings.get('size', self._parent_container.size()))
+                # settings were loaded after the window was shown, so it is moved to the stored position.
+                if init_pos and self._parent_container.isVisible():
+                    self._move_to_init_pos()
 
     def main_layout(self) -> QVBoxLayout | QHBoxLayout | QGridLayout | QLayout:
         """
@@ -865,6 +884,7 @@ class FramelessWindow(QWidget):
         """
 
         if stylesheet:
+            theme.instance().release(self)
             self.setStyleSheet(stylesheet)
         else:
             self.set_default_stylesheet()
@@ -1007,13 +1027,84 @@ class FramelessWindow(QWidget):
 
         self._title_bar.logo_button.set_icon_color(color)
 
+    def is_overlay_enabled(self) -> bool:
+        """
+        Returns whether window can be moved and resized using the Alt modifier (middle button to move and right button
+        to resize).
+
+        :return: True if modifier move and resize is enabled; False otherwise.
+        """
+
+        return self._as_overlay
+
     def show_overlay(self):
         """
         Shows frameless window overlay.
+
+        ..deprecated:: overlay widget no longer exists: Alt modifier move and resize is handled by the input
+            dispatcher, so this function only makes sure the window is registered within it.
         """
 
-        if self._overlay:
-            self._overlay.show()
+        warnings.warn(
+            'FramelessWindow.show_overlay is deprecated: Alt modifier input is handled by the input dispatcher',
+            DeprecationWarning, stacklevel=2)
+        input_dispatcher().register_window(self)
+
+    def paint_profiler(self) -> paintprofiler.PaintProfiler:
+        """
+        Returns the paint profiler of this window, creating it if it does not exist yet.
+
+        :return: window paint profiler.
+        """
+
+        if self._paint_profiler is None:
+            self._paint_profiler = paintprofiler.PaintProfiler(self)
+
+        return self._paint_profiler
+
+    def is_paint_profiler_enabled(self) -> bool:
+        """
+        Returns whether the paint cost of this window widgets is being recorded.
+
+        :return: True if paint profiler is enabled; False otherwise.
+        """
+
+        return self._paint_profiler is not None and self._paint_profiler.is_enabled()
+
+    def set_paint_profiler_enabled(self, flag: bool, overlay: bool = True):
+        """
+        Sets whether the paint cost of this window widgets is recorded. Debug only, because each paint event is
+        dispatched through an event filter.
+
+        :param flag: True to start recording; False to stop it.
+        :param overlay: whether to draw the paint cost heatmap on top of the window while recording.
+        """
+
+        if not flag and self._paint_profiler is None:
+            return
+
+        self.paint_profiler().set_enabled(flag, overlay=overlay)
+
+    def dump_paint_report(self, file_path: str = '') -> dict:
+        """
+        Logs the ranked paint cost report of this window widgets.
+
+        :param file_path: optional JSON file path to write the report to.
+        :return: paint cost report.
+        """
+
+        return self.paint_profiler().dump(file_path)
+
+    def create_task(self, coro: Coroutine, name: str | None = None) -> asyncio.Task:
+        """
+        Schedules given coroutine to run on the Qt asyncio event loop. Task is cancelled when this window closes.
+
+        :param coro: coroutine to run.
+        :param name: optional task name.
+        :return: scheduled task.
+        """
+
+        return asyncloop.create_task(coro, owner=self, name=name)
 
     def attach_to_frameless_window(self, save_window_pref: bool = True):
         """
@@ -1165,6 +1256,7 @@ class FramelessWindow(QWidget):
         self.set_movable(False)
         self._hide_resizers()
         self._parent_container = container
+        input_dispatcher().invalidate()
 
     def _on_undocked(self):
         """
@@ -1173,6 +1265,7 @@ class FramelessWindow(QWidget):
 
         self._show_resizers()
         self.set_movable(True)
+        input_dispatcher().invalidate()
 
     def _on_title_bar_double_clicked(self):
         """
@@ -1345,11 +1438,11 @@ class FramelessTitleBar(QFrame):
         self.setFixedHeight(dpi.dpi_scale(self._title_bar_height))
         self.setLayout(self._main_layout)
 
-        self._close_button.set_icon(QIcon(paths.canonical_path('../../resources/icons/window_close.png')))
-        self._minimize_button.set_icon(QIcon(paths.canonical_path('../../resources/icons/window_minimize.png')))
-        self._maximize_button.set_icon(QIcon(paths.canonical_path('../../resources/icons/window_maximize.png')))
-        self._maximize_button.set_icon(QIcon(paths.canonical_path('../../resources/icons/window_maximize.png')))
-        self._help_button.set_icon(QIcon(paths.canonical_path('../../resources/icons/question.png')))
+        self._close_button.set_icon(resources.icon('window_close'))
+        self._minimize_button.set_icon(resources.icon('window_minimize'))
+        self._maximize_button.set_icon(resources.icon('window_maximize'))
+        self._maximize_button.set_icon(resources.icon('window_maximize'))
+        self._help_button.set_icon(resources.icon('question'))
 
         # Button Setup
         for button in [self._help_button, self._close_button, self._minimize_button, self._maximize_button]:
@@ -1448,13 +1541,7 @@ class FramelessTitleBar(QFrame):
             if moved.manhattanLength() < self._move_threshold:
                 return
 
-            pos = QCursor.pos()
-            new_pos = pos
-            new_pos.setX(pos.x() - self._widget_mouse_pos.x())
-            new_pos.setY(pos.y() - self._widget_mouse_pos.y())
-            delta = new_pos - self.window().pos()
-            self.moving.emit(new_pos, delta)
-            self.window().move(new_pos)
+            self.drag_to(QCursor.pos())
 
     def mouseReleaseEvent(self, event: QMouseEvent):
         """
@@ -1478,6 +1565,23 @@ class FramelessTitleBar(QFrame):
         if self._move_enabled:
             self._widget_mouse_pos = self._frameless_window.mapFromGlobal(QCursor.pos())
 
+    def drag_to(self, global_pos: QPoint):
+        """
+        Moves the title bar parent window, so the position where the movement started follows given cursor position.
+
+        :param global_pos: cursor position in global coordinates.
+        """
+
+        if self._widget_mouse_pos is None or not self._move_enabled:
+            return
+
+        new_pos = global_pos - self._widget_mouse_pos
+        window = self.window()
+        previous_pos = window.pos()
+        # window is moved once per frame, with the latest cursor position.
+        geometry_scheduler().schedule_move(
+            window, new_pos, callback=lambda: self.moving.emit(window.pos(), window.pos() - previous_pos))
+
     def end_move(self):
         """
         Ends the movement of the title bar parent window.
@@ -1485,6 +1589,7 @@ class FramelessTitleBar(QFrame):
 
         if self._move_enabled:
             self._widget_mouse_pos = None
+            geometry_scheduler().flush(self.window())
 
     def refresh(self):
         """
@@ -1678,23 +1783,6 @@ class FramelessTitleBar(QFrame):
         self.open_help()
 
 
-class FramelessKeyboardModifierFilter(QObject):
-
-    modifierPressed = Signal()
-    windowEvent = Signal(object)
-
-    _CURRENT_EVENT = None
-
-    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
-        self._CURRENT_EVENT = event
-        self.windowEvent.emit(event)
-
-        if FramelessOverlay.is_modifier():
-            self.modifierPressed.emit()
-
-        return super().eventFilter(watched, event)
-
-
 class FramelessWindowContents(QFrame):
     """
     Frame that contains the contents of a window.
@@ -1704,219 +1792,140 @@ class FramelessWindowContents(QFrame):
     pass
 
 
-class FramelessOverlay(overlay.OverlayWidget):
-
-    MOVED_BUTTON = Qt.MiddleButton
-    RESIZE_BUTTON = Qt.RightButton
-
-    def __init__(
-            self, parent: FramelessWindow, title_bar: FramelessTitleBar, top_left: CornerResizer | None = None,
-            top_right: CornerResizer | None = None, bottom_left: CornerResizer | None = None,
-            bottom_right: CornerResizer | None = None, resizable: bool = True):
-        """
-        Initialize a new instance of FramelessOverlay.
+class WindowGeometryScheduler(QObject):
+    """
+    Class that coalesces window move and resize requests. Only the latest requested geometry of each window is kept
+    and it is applied at most once per display frame of the screen the window is in.
+    """
 
-        :param parent: The parent window, which should be a FramelessWindow instance.
-        :param title_bar: The title bar for the frameless window, which should be a FramelessTitleBar instance.
-        :param top_left: The resizer for the top-left corner. Default is None.
-        :param top_right: The resizer for the top-right corner. Default is None.
-        :param bottom_left: The resizer for the bottom-left corner. Default is None.
-        :param bottom_right: The resizer for the bottom-right corner. Default is None.
-        :param resizable: Whether the window is resizable. Default is True.
-        """
+    DEFAULT_REFRESH_RATE = 60.0
 
-        super().__init__(parent=parent)
+    def __init__(self):
+        super().__init__()
 
-        self._pressed_at: QPoint | None = None
-        self._resize_direction = 0
-        self._resizable = resizable
-        self._title_bar = title_bar
-        self._top_left = top_left
-        self._top_right = top_right
-        self._bottom_left = bottom_left
-        self._bottom_right = bottom_right
+        self._pending_positions: dict[QWidget, QPoint] = {}
+        self._pending_geometries: dict[QWidget, QRect] = {}
+        self._callbacks: dict[QWidget, callable] = {}
+        self._timer = QTimer(parent=self)
+        self._timer.setSingleShot(True)
+        self._timer.setTimerType(Qt.PreciseTimer)
+        self._timer.timeout.connect(self.flush)
 
-    @classmethod
-    def is_modifier(cls) -> bool:
+    def pending_pos(self, window: QWidget) -> QPoint | None:
         """
-        Check if the current keyboard modifier is the Alt key.
+        Returns the position that will be applied to the given window in the next frame.
 
-        :returns: True if the Alt key is the current keyboard modifier, False otherwise.
+        :param window: window to get pending position of.
+        :return: pending position or None if there is no pending move.
         """
 
-        modifiers = QApplication.keyboardModifiers()
-        return modifiers == Qt.AltModifier
+        geometry = self._pending_geometries.get(window)
+        return geometry.topLeft() if geometry is not None else self._pending_positions.get(window)
 
-    def mousePressEvent(self, event: QMouseEvent):
+    def pending_geometry(self, window: QWidget) -> QRect | None:
         """
-        Handle the mouse press event for the widget.
+        Returns the geometry that will be applied to the given window in the next frame.
 
-        This method processes mouse press events to enable custom behavior such as starting move or resize
-        actions based on certain conditions and modifier keys. It checks if the widget is enabled, whether
-        a modifier key is pressed, and handles resizing based on the direction of the resize action.
-
-        :param event: The QMouseEvent object containing details about the mouse press event.
+        :param window: window to get pending geometry of.
+        :return: copy of the pending geometry or None if there is no pending resize.
         """
 
-        self._pressed_at = QCursor.pos()
-        if not self.isEnabled():
-            event.ignore()
-            super().mousePressEvent(event)
-            return
-
-        if self.is_modifier() and event.buttons() & self.MOVED_BUTTON:
-            self._title_bar.start_move()
-            self.setCursor(Qt.CursorShape.ClosedHandCursor)
-
-        if self.is_modifier() and event.buttons() & self.RESIZE_BUTTON and self._resizable:
-            self._resize_direction = self._quadrant()
-            # noinspection PyUnresolvedReferences
-            if self._resize_direction == ResizerDirection.Top | ResizerDirection.Right:
-                self._top_right.window_resize_start()
-                self.setCursor(Qt.CursorShape.SizeBDiagCursor)
-            elif self._resize_direction == ResizerDirection.Top | ResizerDirection.Left:
-                self._top_left.window_resize_start()
-                self.setCursor(Qt.CursorShape.SizeFDiagCursor)
-            elif self._resize_direction == ResizerDirection.Bottom | ResizerDirection.Left:
-                self._bottom_left.window_resize_start()
-                self.setCursor(Qt.CursorShape.SizeBDiagCursor)
-            elif self._resize_direction == ResizerDirection.Bottom | ResizerDirection.Right:
-                self._bottom_right.window_resize_start()
-                self.setCursor(Qt.CursorShape.SizeFDiagCursor)
-
-        if (not self.is_modifier() and event.buttons() & self.MOVED_BUTTON) or (
-                not self.is_modifier() and event.buttons() & self.RESIZE_BUTTON):
-            self.hide()
+        geometry = self._pending_geometries.get(window)
+        return QRect(geometry) if geometry is not None else None
 
-        event.ignore()
-        return super().mousePressEvent(event)
-
-    def mouseMoveEvent(self, event: QMouseEvent):
+    def schedule_move(self, window: QWidget, pos: QPoint, callback: callable | None = None):
         """
-        Handle the mouse move event for the widget.
-
-        This method processes mouse move events to enable custom behavior such as resizing and hiding
-        the widget based on certain conditions. It checks if the widget is enabled, whether a modifier
-        key is pressed, and handles resizing based on the direction of the resize action.
+        Schedules a window move for the next frame, replacing any pending move of the window.
 
-        :param event: The QMouseEvent object containing details about the mouse move event.
+        :param window: window to move.
+        :param pos: new window position.
+        :param callback: optional function called after applying the move.
         """
 
-        if not self.isEnabled():
-            event.ignore()
-            super().mouseMoveEvent(event)
-            return
-
-        if not self.is_modifier():
-            self.hide()
-            return
-
-        self._title_bar.mouseMoveEvent(event)
-
-        if self._resize_direction != 0:
-            # noinspection PyUnresolvedReferences
-            if self._resize_direction == ResizerDirection.Top | ResizerDirection.Right:
-                self._top_right.windowResized.emit()
-            elif self._resize_direction == ResizerDirection.Top | ResizerDirection.Left:
-                self._top_left.windowResized.emit()
-            elif self._resize_direction == ResizerDirection.Bottom | ResizerDirection.Left:
-                self._bottom_left.windowResized.emit()
-            elif self._resize_direction == ResizerDirection.Bottom | ResizerDirection.Right:
-                self._bottom_right.windowResized.emit()
-
-        event.ignore()
-
-        super().mouseMoveEvent(event)
+        geometry = self._pending_geometries.get(window)
+        if geometry is not None:
+            geometry.moveTopLeft(pos)
+        else:
+            self._pending_positions[window] = QPoint(pos)
+        if callback is not None:
+            self._callbacks[window] = callback
+        self._start(window)
 
-    def mouseReleaseEvent(self, event: QMouseEvent):
+    def schedule_geometry(self, window: QWidget, geometry: QRect, callback: callable | None = None):
         """
-        Handle the mouse release event for the widget.
-
-        This method processes mouse release events to enable custom behavior such as ending move actions
-        and emitting signals for finished resizing. It also checks if the mouse was clicked without any
-        movement and performs an action based on that condition.
+        Schedules a window geometry change for the next frame, replacing any pending move or resize of the window.
 
-        :param event: The QMouseEvent object containing details about the mouse release event.
+        :param window: window to change geometry of.
+        :param geometry: new window geometry.
+        :param callback: optional function called after applying the geometry.
         """
 
-        if not self.isEnabled():
-            event.ignore()
-            super().mouseReleaseEvent(event)
-            return
-
-        self._title_bar.end_move()
-        self._top_left.windowResizedFinished.emit()
-        self._top_right.windowResizedFinished.emit()
-        self._bottom_left.windowResizedFinished.emit()
-        self._bottom_right.windowResizedFinished.emit()
-        self._resize_direction = 0
-        event.ignore()
-
-        if self._pressed_at - QCursor.pos() == QPoint(0, 0):
-            utils.click_under(QCursor.pos(), 1, modifier=Qt.AltModifier)
+        self._pending_positions.pop(window, None)
+        self._pending_geometries[window] = QRect(geometry)
+        if callback is not None:
+            self._callbacks[window] = callback
+        self._start(window)
 
-        super().mouseReleaseEvent(event)
-
-    def setEnabled(self, flag: bool):
+    def flush(self, window: QWidget | None = None):
         """
-        Set the enabled state of the widget.
-
-        This method sets the enabled state of the widget. It toggles the debug mode and visibility based on the flag
-        value, and then calls the base class's setEnabled method to handle additional behavior.
+        Applies pending moves and resizes immediately.
 
-        :param flag: A boolean value indicating whether the widget should be enabled (True) or disabled (False).
+        :param window: optional window to apply pending changes of. If not given, all pending changes are applied.
         """
 
-        self.set_debug_mode(not flag)
-        self.setVisible(flag)
-        super().setEnabled(flag)
+        windows = [window] if window is not None else list(
+            set(self._pending_positions.keys()) | set(self._pending_geometries.keys()))
+        for found_window in windows:
+            pos = self._pending_positions.pop(found_window, None)
+            geometry = self._pending_geometries.pop(found_window, None)
+            callback = self._callbacks.pop(found_window, None)
+            try:
+                if geometry is not None:
+                    found_window.setGeometry(geometry)
+                elif pos is not None:
+                    found_window.move(pos)
+                else:
+                    continue
+            except RuntimeError:
+                # Qt object was already deleted.
+                continue
+            if callback is not None:
+                callback()
+        if not self._pending_positions and not self._pending_geometries:
+            self._timer.stop()
 
-    def show(self):
+    def _start(self, window: QWidget):
         """
-        Show the widget.
+        Internal function that starts frame timer, if it is not running already.
 
-        This method updates the widget's stylesheet and then calls the base class's show method if the widget is
-        enabled. If the widget is disabled, it logs a warning message indicating that the show method was called while
-        the widget is disabled.
+        :param window: window whose screen refresh rate is used.
         """
 
-        self.update_stylesheet()
-        if self.isEnabled():
-            super().show()
-        else:
-            logger.warning('FramelessOverlay.show() was called when it is disabled')
+        if self._timer.isActive():
+            return
 
-    def update_stylesheet(self):
-        """
-        Updates style sheet.
-        """
+        screen = dpi.widget_screen(window)
+        refresh_rate = screen.refreshRate() if screen is not None else 0.0
+        refresh_rate = refresh_rate if refresh_rate > 0 else self.DEFAULT_REFRESH_RATE
+        self._timer.start(max(1, int(1000.0 / refresh_rate)))
 
-        self.set_debug_mode(self._debug)
 
-    def _quadrant(self) -> int:
-        """
-        Internal function that returns the quadrant of where the mouse is located and returns the resizer direction.
+_GEOMETRY_SCHEDULER: WindowGeometryScheduler | None = None
 
-        :return: resizer direction.
-        """
 
-        mid_x = self.geometry().width() / 2
-        mid_y = self.geometry().height() / 2
-        result = 0
+def geometry_scheduler() -> WindowGeometryScheduler:
+    """
+    Returns global window geometry scheduler instance.
 
-        pos = self.mapFromGlobal(QCursor.pos())
+    :return: window geometry scheduler.
+    """
 
-        if pos.x() < mid_x:
-            result = result | ResizerDirection.Left
-        elif pos.x() > mid_x:
-            result = result | ResizerDirection.Right
+    global _GEOMETRY_SCHEDULER
 
-        if pos.y() < mid_y:
-            result = result | ResizerDirection.Top
-        elif pos.y() > mid_y:
-            result = result | ResizerDirection.Bottom
+    if _GEOMETRY_SCHEDULER is None:
+        _GEOMETRY_SCHEDULER = WindowGeometryScheduler()
 
-        return result
+    return _GEOMETRY_SCHEDULER
 
 
 class ResizerDirection:
@@ -1943,69 +1952,78 @@ class Resizers:
 
 
 class WindowResizer(QObject):
+    """
+    Class that reserves the resize border of a frameless window and resizes the window from it.
+    No resizer widgets are created: border hit-testing and mouse handling is done by the application input dispatcher.
+    """
+
+    RESIZE_MARGIN = 8
 
     resizeFinished = Signal()
 
-    def __init__(self, parent, install_to_layout=None):
+    def __init__(self, parent: FramelessWindow, install_to_layout: QGridLayout | None = None):
         """
         Initialize a new instance of the WindowResizer class.
 
-        :param parent: The parent object for the WindowResizer instance.
-        :param install_to_layout: Optional. The layout to which the resizer should be installed.
+        :param parent: The frameless window to resize.
+        :param install_to_layout: Optional. The layout whose margins reserve the resize border.
         """
 
         super().__init__(parent=parent)
 
         self._frameless_parent = parent
-        self._layout = None
+        self._layout: QGridLayout | None = None
         self._is_visible = True
-        self._top_left_resizer: CornerResizer | None = None
-        self._top_left_resizer: CornerResizer | None = None
-        self._bottom_left_resizer: CornerResizer | None = None
-        self._bottom_right_resizer: CornerResizer | None = None
+        self._enabled = True
+        self._direction = 0
+        self._press_pos: QPoint | None = None
+        self._press_geometry: QRect | None = None
 
         self._install_to_layout(install_to_layout, parent)
-        self._setup_signals()
 
     @property
-    def top_left_resizer(self) -> CornerResizer:
+    def top_left_resizer(self) -> WindowResizer:
         """
         Getter method for the top-left corner resizer of the window.
 
-        :returns: The corner resizer object for the top-left corner.
+        ..deprecated:: corner resizer widgets no longer exist: corners are handled by this resizer.
+        :returns: this window resizer.
         """
 
-        return self._top_left_resizer
+        return self._deprecated_corner_resizer('top_left_resizer')
 
     @property
-    def top_right_resizer(self) -> CornerResizer:
+    def top_right_resizer(self) -> WindowResizer:
         """
         Getter method for the top-right corner resizer of the window.
 
-        :returns: The corner resizer object for the top-right corner.
+        ..deprecated:: corner resizer widgets no longer exist: corners are handled by this resizer.
+        :returns: this window resizer.
         """
 
-        return self._top_right_resizer
+        return self._deprecated_corner_resizer('top_right_resizer')
 
     @property
-    def bottom_left_resizer(self) -> CornerResizer:
+    def bottom_left_resizer(self) -> WindowResizer:
         """
         Getter method for the bottom-left corner resizer of the window.
 
-        :returns: The corner resizer object for the bottom-left corner.
+        ..deprecated:: corner resizer widgets no longer exist: corners are handled by this resizer.
+        :returns: this window resizer.
         """
 
-        return self._bottom_left_resizer
+        return self._deprecated_corner_resizer('bottom_left_resizer')
 
     @property
-    def bottom_right_resizer(self) -> CornerResizer:
+    def bottom_right_resizer(self) -> WindowResizer:
         """
         Getter method for the bottom-right corner resizer of the window.
 
-        :returns: The corner resizer object for the bottom-right corner.
+        ..deprecated:: corner resizer widgets no longer exist: corners are handled by this resizer.
+        :returns: this window resizer.
         """
 
-        return self._bottom_right_resizer
+        return self._deprecated_corner_resizer('bottom_right_resizer')
 
     # noinspection SpellCheckingInspection
     def show(self):
@@ -2014,8 +2032,7 @@ class WindowResizer(QObject):
         """
 
         self._is_visible = True
-        for resizer in self._resizers:
-            resizer.show()
+        self._update_margins()
 
     # noinspection SpellCheckingInspection
     def hide(self):
@@ -2024,8 +2041,7 @@ class WindowResizer(QObject):
         """
 
         self._is_visible = False
-        for resizer in self._resizers:
-            resizer.hide()
+        self._update_margins()
 
     # noinspection SpellCheckingInspection
     def is_visible(self) -> bool:
@@ -2037,6 +2053,33 @@ class WindowResizer(QObject):
 
         return self._is_visible
 
+    def is_enabled(self) -> bool:
+        """
+        Returns whether resizers are enabled.
+
+        :return: True if resizers are enabled; False otherwise.
+        """
+
+        return self._enabled
+
+    def is_resizing(self) -> bool:
+        """
+        Returns whether a resize operation is being done.
+
+        :return: True if window is being resized; False otherwise.
+        """
+
+        return self._direction != 0
+
+    def margin(self) -> int:
+        """
+        Returns the size of the resize border, scaled by the DPI of the window screen.
+
+        :return: resize border size.
+        """
+
+        return int(dpi.dpi_scale(self.RESIZE_MARGIN, self._frameless_parent))
+
     # noinspection SpellCheckingInspection
     def resizer_height(self) -> int:
         """
@@ -2045,13 +2088,7 @@ class WindowResizer(QObject):
         :return: resizer height.
         """
 
-        resizers = [self._top_resizer, self._bottom_resizer]
-        result = 0
-        for r in resizers:
-            if not r.isHidden():
-                result += r.minimumSize().height()
-
-        return result
+        return self.margin() * 2 if self._is_visible else 0
 
     # noinspection SpellCheckingInspection
     def resizer_width(self) -> int:
@@ -2061,28 +2098,20 @@ class WindowResizer(QObject):
         :return: resizer width.
         """
 
-        resizers = [self._left_resizer, self._right_resizer]
-        ret = 0
-        for r in resizers:
-            if not r.isHidden():
-                ret += r.minimumSize().width()
-
-        return ret
+        return self.margin() * 2 if self._is_visible else 0
 
-    # noinspection PyUnresolvedReferences
     def set_resize_directions(self):
         """
         Sets the resize directions for the window resizer widgets.
+
+        ..deprecated:: resize directions are computed from the cursor position within the window border, so this
+            function only updates the reserved resize border.
         """
 
-        self._top_resizer.set_resize_direction(ResizerDirection.Top)
-        self._bottom_resizer.set_resize_direction(ResizerDirection.Bottom)
-        self._right_resizer.set_resize_direction(ResizerDirection.Right)
-        self._left_resizer.set_resize_direction(ResizerDirection.Left)
-        self._top_left_resizer.set_resize_direction(ResizerDirection.Left | ResizerDirection.Top)
-        self._top_right_resizer.set_resize_direction(ResizerDirection.Right | ResizerDirection.Top)
-        self._bottom_left_resizer.set_resize_direction(ResizerDirection.Left | ResizerDirection.Bottom)
-        self._bottom_right_resizer.set_resize_direction(ResizerDirection.Right | ResizerDirection.Bottom)
+        warnings.warn(
+            'WindowResizer.set_resize_directions is deprecated: resize directions are computed by hit_test',
+            DeprecationWarning, stacklevel=2)
+        self._update_margins()
 
     # noinspection SpellCheckingInspection
     def set_resizer_active(self, flag: bool):
@@ -2102,15 +2131,99 @@ class WindowResizer(QObject):
         :param flag: True to enable resizers; False otherwise.
         """
 
-        [resizer.setEnabled(flag) for resizer in self._resizers]
+        self._enabled = bool(flag)
+
+    def hit_test(self, global_pos: QPoint) -> int:
+        """
+        Returns the resize direction of the window border under the given position.
+
+        :param global_pos: position in global coordinates.
+        :return: resize direction (combination of ResizerDirection flags) or 0 if position is not over the border.
+        """
+
+        if not self._enabled or not self._is_visible:
+            return 0
+
+        pos = self._frameless_parent.mapFromGlobal(global_pos)
+        rect = self._frameless_parent.rect()
+        if not rect.contains(pos):
+            return 0
+
+        margin = self.margin()
+        direction = 0
+        if pos.x() < margin:
+            direction |= ResizerDirection.Left
+        elif pos.x() >= rect.width() - margin:
+            direction |= ResizerDirection.Right
+        if pos.y() < margin:
+            direction |= ResizerDirection.Top
+        elif pos.y() >= rect.height() - margin:
+            direction |= ResizerDirection.Bottom
+
+        return direction
+
+    def start_resize(self, direction: int, global_pos: QPoint):
+        """
+        Starts a resize operation.
+
+        :param direction: resize direction (combination of ResizerDirection flags).
+        :param global_pos: cursor position in global coordinates.
+        """
 
-    # noinspection SpellCheckingInspection, PyUnresolvedReferences
-    def _install_to_layout(self, grid_layout: QGridLayout, parent: QObject | QWidget):
+        self._direction = direction
+        self._press_pos = QPoint(global_pos)
+        self._press_geometry = self._frameless_parent.window().frameGeometry()
+
+    def update_resize(self, global_pos: QPoint):
         """
-        Internal function that install resizers into the given grid layout.
+        Resizes the window based on the given cursor position and the current resize direction.
 
-        :param grid_layout: grid layout to install resizers into.
-        :param parent: parent widget to install layout into.
+        :param global_pos: cursor position in global coordinates.
+        """
+
+        if not self._direction:
+            return
+
+        window = self._frameless_parent.window()
+        delta = global_pos - self._press_pos
+        geometry = QRect(self._press_geometry)
+        min_width = window.minimumSize().width()
+        min_height = window.minimumSize().height()
+
+        if self._direction & ResizerDirection.Left:
+            geometry.setLeft(min(geometry.left() + delta.x(), geometry.right() - min_width + 1))
+        elif self._direction & ResizerDirection.Right:
+            geometry.setRight(max(geometry.right() + delta.x(), geometry.left() + min_width - 1))
+        if self._direction & ResizerDirection.Top:
+            geometry.setTop(min(geometry.top() + delta.y(), geometry.bottom() - min_height + 1))
+        elif self._direction & ResizerDirection.Bottom:
+            geometry.setBottom(max(geometry.bottom() + delta.y(), geometry.top() + min_height - 1))
+
+        # window is resized once per frame, with the latest cursor position.
+        geometry_scheduler().schedule_geometry(window, geometry)
+
+    def finish_resize(self):
+        """
+        Ends current resize operation.
+        """
+
+        if not self._direction:
+            return
+
+        self._direction = 0
+        self._press_pos = None
+        self._press_geometry = None
+        geometry_scheduler().flush(self._frameless_parent.window())
+        self.resizeFinished.emit()
+
+    # noinspection SpellCheckingInspection
+    def _install_to_layout(self, grid_layout: QGridLayout, parent: FramelessWindow):
+        """
+        Internal function that reserves the resize border within the given grid layout and registers the window
+        within the input dispatcher.
+
+        :param grid_layout: grid layout whose margins reserve the resize border.
+        :param parent: frameless window to resize.
         """
 
         if not isinstance(grid_layout, QGridLayout):
@@ -2118,246 +2231,348 @@ class WindowResizer(QObject):
             return
 
         self._layout = grid_layout
+        self._update_margins()
 
-        self._top_resizer = VerticalResizer(ResizerDirection.Top, parent=parent)
-        self._bottom_resizer = VerticalResizer(ResizerDirection.Bottom, parent=parent)
-        self._right_resizer = HorizontalResizer(ResizerDirection.Right, parent=parent)
-        self._left_resizer = HorizontalResizer(ResizerDirection.Left, parent=parent)
-        self._top_left_resizer = CornerResizer(ResizerDirection.Left | ResizerDirection.Top, parent=parent)
-        self._top_right_resizer = CornerResizer(ResizerDirection.Right | ResizerDirection.Top, parent=parent)
-        self._bottom_left_resizer = CornerResizer(ResizerDirection.Left | ResizerDirection.Bottom, parent=parent)
-        self._bottom_right_resizer = CornerResizer(ResizerDirection.Right | ResizerDirection.Bottom, parent=parent)
-
-        self._resizers = [
-            self._top_resizer, self._top_right_resizer, self._right_resizer, self._bottom_right_resizer,
-            self._bottom_resizer, self._bottom_left_resizer, self._left_resizer, self._top_left_resizer
-        ]
-
-        grid_layout.addWidget(self._top_left_resizer, 0, 0, 1, 1)
-        grid_layout.addWidget(self._top_resizer, 0, 1, 1, 1)
-        grid_layout.addWidget(self._top_right_resizer, 0, 2, 1, 1)
-        grid_layout.addWidget(self._left_resizer, 1, 0, 2, 1)
-        grid_layout.addWidget(self._right_resizer, 1, 2, 2, 1)
-        grid_layout.addWidget(self._bottom_left_resizer, 3, 0, 1, 1)
-        grid_layout.addWidget(self._bottom_resizer, 3, 1, 1, 1)
-        grid_layout.addWidget(self._bottom_right_resizer, 3, 2, 1, 1)
-
-        self.set_resize_directions()
+        # hover move events are needed to update the cursor over the resize border.
+        parent.setMouseTracking(True)
+        input_dispatcher().register_window(parent)
 
-    def _setup_signals(self):
+    def _deprecated_corner_resizer(self, name: str) -> WindowResizer:
         """
-        Internal function that setup resizer signals.
+        Internal function that warns about the use of a removed corner resizer accessor.
+
+        :param name: name of the accessor.
+        :return: this window resizer, which handles all the window corners.
         """
 
-        for resizer in self._resizers:
-            resizer.windowResizedFinished.connect(self.resizeFinished.emit)
+        warnings.warn(
+            f'WindowResizer.{name} is deprecated: corners are handled by the window resizer itself',
+            DeprecationWarning, stacklevel=3)
 
+        return self
 
-class Resizer(QWidget):
-    """
-    Base class that defines resizer widget functionality
-    Those resizers can be used in windows and dialogs
-    """
+    def _update_margins(self):
+        """
+        Internal function that updates layout margins, so the resize border is kept free of child widgets.
+        """
 
-    windowResized = Signal()                  # signal emitted when a resize operation is being done
-    windowResizedStarted = Signal()           # signal emitted when a resize operation starts
-    windowResizedFinished = Signal()          # signal emitted when a resize operation ends
+        if self._layout is None:
+            return
 
-    def __init__(self, direction, parent, debug=False):
-        super().__init__(parent)
+        margin = self.margin() if self._is_visible else 0
+        self._layout.setContentsMargins(margin, margin, margin, margin)
 
-        self._direction = direction         # resize direction
-        self._widget_mouse_pos = None       # caches the position of the mouse
-        self._widget_geometry = None        # caches the geometry of the resized widget
 
-        if not debug:
-            self.setStyleSheet('background-color: transparent;')
-        else:
-            self.setStyleSheet('background-color: #88990000')
+class FramelessInputDispatcher(QObject):
+    """
+    Application event filter that handles the mouse input of all frameless windows.
 
-        self.set_resize_direction(direction)
+    Resize borders are hit-tested geometrically and Alt modifier behaviour (middle button moves the window and right
+    button resizes it from the nearest corner) is applied directly, so no resizer or overlay widgets are needed.
+    Window moves and resizes are done through the geometry scheduler.
+    """
 
-        # # make sure that resizers are invisible
-        # self.setAttribute(Qt.WA_TranslucentBackground)
+    MODIFIER = Qt.AltModifier
+    MOVE_BUTTON = Qt.MiddleButton
+    RESIZE_BUTTON = Qt.RightButton
 
-        self.windowResized.connect(self._on_window_resized)
-        self.windowResizedStarted.connect(self._on_window_resize_started)
+    _MOVE = 1
+    _RESIZE = 2
 
-    def paintEvent(self, event: QPaintEvent):
+    def __init__(self):
+        super().__init__()
+
+        self._windows: weakref.WeakSet[FramelessWindow] = weakref.WeakSet()
+        self._top_level_windows: weakref.WeakKeyDictionary[QWidget, FramelessWindow | None] = \
+            weakref.WeakKeyDictionary()
+        self._installed = False
+        self._active_window: FramelessWindow | None = None
+        self._operation = 0
+        self._press_pos: QPoint | None = None
+        self._modifier_operation = False
+        self._hover_window: FramelessWindow | None = None
+        self._hover_direction = 0
+
+    def register_window(self, window: FramelessWindow):
         """
-        Overrides base QFrame paintEvent function
-        Override to make mouse events work in transparent widgets.
+        Registers given frameless window, so its input is handled by this dispatcher.
+        Event filter is installed into the application when the first window is registered.
 
-        :param event: Qt paint event
+        :param window: frameless window to register.
         """
 
-        painter = QPainter(self)
-        painter.fillRect(self.rect(), QColor(255, 0, 0, 0))
-        painter.end()
+        self._windows.add(window)
+        self.invalidate()
+        if not self._installed and QApplication.instance() is not None:
+            QApplication.instance().installEventFilter(self)
+            self._installed = True
 
-    def mousePressEvent(self, event: QMouseEvent):
+    def unregister_window(self, window: FramelessWindow):
         """
-        Overrides base QFrame mousePressEvent function
+        Unregisters given frameless window.
 
-        :param event: Qt mouse event
+        :param window: frameless window to unregister.
         """
 
-        self.windowResizedStarted.emit()
+        self._windows.discard(window)
+        if self._hover_window is window:
+            self._hover_window = None
+            self._hover_direction = 0
+        self.invalidate()
 
-    def mouseMoveEvent(self, event: QMouseEvent):
+    def invalidate(self):
         """
-        Overrides base QFrame mouseMoveEvent function
-
-        :param event: Qt mouse event
+        Clears the cache of top level windows. Must be called when frameless windows are reparented (e.g: docked).
         """
 
-        self.windowResized.emit()
+        self._top_level_windows.clear()
 
-    def mouseReleaseEvent(self, event: QMouseEvent):
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
         """
-        Overrides base QFrame mouseReleaseEvent function
+        Overrides base eventFilter function to handle frameless windows mouse events.
 
-        :param event: Qt mouse event
+        :param watched: object that receives the event.
+        :param event: Qt event.
+        :return: True if event was consumed; False otherwise.
         """
 
-        self.windowResizedFinished.emit()
+        event_type = event.type()
+        if event_type not in _DISPATCHED_EVENTS or not watched.isWidgetType():
+            return False
 
-    def set_resize_direction(self, direction: int):
-        """
-        Sets the resize direction
+        if self._operation:
+            return self._handle_operation(event_type, event)
 
-        .. code-block:: python
-            setResizeDirection(ResizeDirection.Left | ResizeDirection.Top)
+        if event_type == QEvent.Enter or event_type == QEvent.Leave:
+            if self._hover_window is not None and (event_type == QEvent.Enter) != (watched is self._hover_window):
+                self._set_hover(None, 0)
+            return False
 
-        :param direction: resize direction.
-        """
+        frameless_window = self._frameless_window(watched)
+        if frameless_window is None:
+            return False
 
-        self._direction = direction
+        if event_type == QEvent.MouseMove:
+            if event.buttons() == Qt.NoButton:
+                self._set_hover(frameless_window, frameless_window.window_resizer.hit_test(event.globalPos()))
+            return False
+        if event_type == QEvent.MouseButtonPress:
+            return self._on_mouse_pressed(frameless_window, event)
+
+        return False
 
-    def window_resize_start(self):
+    def _frameless_window(self, widget: QWidget) -> FramelessWindow | None:
         """
-        Start resize operation.
+        Internal function that returns the registered frameless window the given widget belongs to.
+        Lookup is done by top level window and cached.
+
+        :param widget: widget to get frameless window of.
+        :return: frameless window or None if widget does not belong to a registered frameless window.
         """
 
-        self._widget_mouse_pos = self.mapFromGlobal(QCursor.pos())
-        self._widget_geometry = self.window().frameGeometry()
+        top_level = widget.window()
+        try:
+            return self._top_level_windows[top_level]
+        except KeyError:
+            pass
 
-    def _on_window_resized(self):
+        found_window = None
+        for window in list(self._windows):
+            try:
+                if window.window() is top_level:
+                    found_window = window
+                    break
+            except RuntimeError:
+                # Qt object was already deleted.
+                self._windows.discard(window)
+        self._top_level_windows[top_level] = found_window
+
+        return found_window
+
+    def _set_hover(self, frameless_window: FramelessWindow | None, direction: int):
         """
-        Internal function that resizes the frame based on the mouse position and the current direction.
+        Internal function that updates the cursor shape of the hovered frameless window resize border.
+
+        :param frameless_window: hovered frameless window.
+        :param direction: hovered resize direction or 0 if no resize border is hovered.
         """
 
-        pos = QCursor.pos()
-        new_geo = self.window().frameGeometry()
+        if frameless_window is self._hover_window and direction == self._hover_direction:
+            return
+
+        if self._hover_window is not None and self._hover_direction:
+            try:
+                self._hover_window.unsetCursor()
+            except RuntimeError:
+                pass
+        if frameless_window is not None and direction:
+            frameless_window.setCursor(_resize_cursor_shape(direction))
+        self._hover_window = frameless_window if direction else None
+        self._hover_direction = direction
 
-        min_width = self.window().minimumSize().width()
-        min_height = self.window().minimumSize().height()
+    def _on_mouse_pressed(self, frameless_window: FramelessWindow, event: QMouseEvent) -> bool:
+        """
+        Internal function that starts a move or a resize operation, if the press happened over a resize border or
+        with the modifier key pressed.
 
-        if self._direction & ResizerDirection.Left == ResizerDirection.Left:
-            left = new_geo.left()
-            new_geo.setLeft(pos.x() - self._widget_mouse_pos.x())
-            if new_geo.width() <= min_width:
-                new_geo.setLeft(left)
-        if self._direction & ResizerDirection.Top == ResizerDirection.Top:
-            top = new_geo.top()
-            new_geo.setTop(pos.y() - self._widget_mouse_pos.y())
-            if new_geo.height() <= min_height:
-                new_geo.setTop(top)
-        if self._direction & ResizerDirection.Right == ResizerDirection.Right:
-            new_geo.setRight(pos.x() + (self.minimumSize().width() - self._widget_mouse_pos.x()))
-        if self._direction & ResizerDirection.Bottom == ResizerDirection.Bottom:
-            new_geo.setBottom(pos.y() + (self.minimumSize().height() - self._widget_mouse_pos.y()))
+        :param frameless_window: pressed frameless window.
+        :param event: Qt mouse event.
+        :return: True if event was consumed; False otherwise.
+        """
+
+        button = event.button()
+        global_pos = event.globalPos()
+        modifier = event.modifiers() == self.MODIFIER and frameless_window.is_overlay_enabled()
+        resizer = frameless_window.window_resizer
+
+        if modifier and button == self.MOVE_BUTTON:
+            if not frameless_window.is_movable():
+                return False
+            frameless_window.title_bar.start_move()
+            self._start_operation(frameless_window, self._MOVE, global_pos, modifier, Qt.ClosedHandCursor)
+            return True
+
+        direction = 0
+        if resizer.is_enabled():
+            if modifier and button == self.RESIZE_BUTTON:
+                direction = self._quadrant(frameless_window, global_pos)
+            elif button == Qt.LeftButton:
+                direction = resizer.hit_test(global_pos)
+        if not direction:
+            return False
 
-        x = new_geo.x()
-        y = new_geo.y()
-        w = max(new_geo.width(), min_width)
-        h = max(new_geo.height(), min_height)
+        resizer.start_resize(direction, global_pos)
+        self._start_operation(frameless_window, self._RESIZE, global_pos, modifier, _resize_cursor_shape(direction))
 
-        self.window().setGeometry(x, y, w, h)
+        return True
 
-    def _on_window_resize_started(self):
-        """
-        Internal callback function that is called when resize operation starts
+    def _start_operation(
+            self, frameless_window: FramelessWindow, operation: int, global_pos: QPoint, modifier: bool,
+            cursor_shape: Qt.CursorShape):
         """
+        Internal function that stores the state of a new move or resize operation.
 
-        self.window_resize_start()
+        :param frameless_window: frameless window to move or resize.
+        :param operation: operation type.
+        :param global_pos: press position in global coordinates.
+        :param modifier: whether operation was started with the modifier key.
+        :param cursor_shape: cursor shape to show during the operation.
+        """
 
+        self._active_window = frameless_window
+        self._operation = operation
+        self._press_pos = QPoint(global_pos)
+        self._modifier_operation = modifier
+        QApplication.setOverrideCursor(cursor_shape)
 
-class CornerResizer(Resizer, object):
-    """
-    Resizer implementation for window corners
-    """
-
-    def __init__(self, direction: int | Qt.CursorShape, parent: QWidget | None = None):
+    def _handle_operation(self, event_type: QEvent.Type, event: QEvent) -> bool:
         """
-        Initialize a new instance of the CornerResizer class.
+        Internal function that handles mouse events while a move or a resize operation is being done.
 
-        :param direction: The direction or cursor shape of the resizer.
-        :param parent: The parent widget, if any. Default is None, indicating no parent.
+        :param event_type: event type.
+        :param event: Qt event.
+        :return: True if event was consumed; False otherwise.
         """
 
-        super().__init__(direction=direction, parent=parent)
+        if event_type == QEvent.Enter or event_type == QEvent.Leave:
+            return False
 
-        self.setFixedSize(dpi.size_by_dpi(QSize(10, 10)))
+        frameless_window = self._active_window
+        if event_type == QEvent.MouseMove:
+            try:
+                if self._operation == self._MOVE:
+                    frameless_window.title_bar.drag_to(event.globalPos())
+                else:
+                    frameless_window.window_resizer.update_resize(event.globalPos())
+            except RuntimeError:
+                # Qt object was already deleted.
+                self._end_operation()
+            return True
+        if event_type != QEvent.MouseButtonRelease:
+            return True
+
+        moved = event.globalPos() != self._press_pos
+        modifier_operation = self._modifier_operation
+        try:
+            if self._operation == self._MOVE:
+                frameless_window.title_bar.end_move()
+            else:
+                frameless_window.window_resizer.finish_resize()
+        except RuntimeError:
+            pass
+        self._end_operation()
 
-    # noinspection PyUnresolvedReferences
-    def set_resize_direction(self, direction):
-        super().set_resize_direction(direction)
+        # a modifier click without movement is forwarded to the widget under the cursor.
+        if modifier_operation and not moved:
+            utils.click_under(event.globalPos(), 0, modifier=self.MODIFIER)
 
-        if direction == ResizerDirection.Left | ResizerDirection.Top or \
-                direction == ResizerDirection.Right | ResizerDirection.Bottom:
-            self.setCursor(Qt.SizeFDiagCursor)
-        elif direction == ResizerDirection.Right | ResizerDirection.Top or \
-                direction == ResizerDirection.Left | ResizerDirection.Bottom:
-            self.setCursor(Qt.SizeBDiagCursor)
+        return True
 
+    def _end_operation(self):
+        """
+        Internal function that clears the state of current move or resize operation.
+        """
 
-class VerticalResizer(Resizer, object):
-    """
-    Resizer implementation for top and bottom sides of the window
-    """
+        self._active_window = None
+        self._operation = 0
+        self._press_pos = None
+        self._modifier_operation = False
+        QApplication.restoreOverrideCursor()
 
-    def __init__(self, direction: int | Qt.CursorShape = Qt.SizeVerCursor, parent: QWidget | None = None):
+    @staticmethod
+    def _quadrant(frameless_window: FramelessWindow, global_pos: QPoint) -> int:
         """
-        Initialize a new instance of the VerticalResizer class.
+        Internal function that returns the resize direction of the window corner nearest to the given position.
 
-        :param direction: The cursor shape or direction of resizing. Default is Qt.SizeVerCursor, indicating vertical
-            resizing.
-        :param parent: The parent widget, if any. Default is None, indicating no parent.
+        :param frameless_window: frameless window.
+        :param global_pos: position in global coordinates.
+        :return: resize direction.
         """
 
-        super().__init__(direction=direction, parent=parent)
+        pos = frameless_window.mapFromGlobal(global_pos)
+        rect = frameless_window.rect()
+        direction = ResizerDirection.Left if pos.x() < rect.width() / 2 else ResizerDirection.Right
+        direction |= ResizerDirection.Top if pos.y() < rect.height() / 2 else ResizerDirection.Bottom
 
-        self.setFixedHeight(dpi.dpi_scale(8))
+        return direction
 
-    def set_resize_direction(self, direction: int):
-        super().set_resize_direction(direction)
 
-        self.setCursor(Qt.SizeVerCursor)
+_DISPATCHED_EVENTS = frozenset(
+    (QEvent.MouseMove, QEvent.MouseButtonPress, QEvent.MouseButtonRelease, QEvent.Enter, QEvent.Leave))
+_INPUT_DISPATCHER: FramelessInputDispatcher | None = None
 
 
-class HorizontalResizer(Resizer, object):
+def input_dispatcher() -> FramelessInputDispatcher:
     """
-    Resizer implementation for left and right sides of the window
+    Returns global frameless windows input dispatcher instance.
+
+    :return: frameless input dispatcher.
     """
 
-    def __init__(self, direction: int | Qt.CursorShape = Qt.SizeHorCursor, parent=None):
-        """
-        Initialize a new instance of the HorizontalResizer class.
+    global _INPUT_DISPATCHER
 
-        :param direction: The cursor shape or direction of resizing. Default is Qt.SizeVerCursor, indicating vertical
-            resizing.
-        :param parent: The parent widget, if any. Default is None, indicating no parent.
-        """
+    if _INPUT_DISPATCHER is None:
+        _INPUT_DISPATCHER = FramelessInputDispatcher()
+
+    return _INPUT_DISPATCHER
 
-        super().__init__(direction=direction, parent=parent)
 
-        self.setFixedHeight(dpi.dpi_scale(8))
+def _resize_cursor_shape(direction: int) -> Qt.CursorShape:
+    """
+    Internal function that returns the cursor shape for the given resize direction.
+
+    :param direction: resize direction (combination of ResizerDirection flags).
+    :return: cursor shape.
+    """
 
-    def set_resize_direction(self, direction):
-        super().set_resize_direction(direction)
+    horizontal = direction & (ResizerDirection.Left | ResizerDirection.Right)
+    vertical = direction & (ResizerDirection.Top | ResizerDirection.Bottom)
+    if horizontal and vertical:
+        if direction in (ResizerDirection.Left | ResizerDirection.Top, ResizerDirection.Right | ResizerDirection.Bottom):
+            return Qt.SizeFDiagCursor
+        return Qt.SizeBDiagCursor
 
-        self.setCursor(Qt.SizeHorCursor)
+    return Qt.SizeHorCursor if horizontal else Qt.SizeVerCursor
 
 
 class SpawnerIcon(buttons.IconMenuButton):
@@ -2509,7 +2724,7 @@ class SpawnerIcon(buttons.IconMenuButton):
 
         min_size = 0.55 if self._window.isMinimized() else 1
         size = uiconsts.Sizes.TitleLogoIcon * min_size
-        logo_icon = QIcon(paths.canonical_path('../../resources/icons/tpdcc.png'))
+        logo_icon = resources.icon('tpdcc')
 
         if flag:
             self.set_icon(logo_icon, colors=[None, None], size=size, scaling=[1], color_offset=40)
@@ -2574,6 +2789,12 @@ class SpawnerIcon(buttons.IconMenuButton):
         self.setIconSize(QSize(size, size))
         self.setFixedSize(QSize(size + uiconsts.Sizes.Margin / 2, size + uiconsts.Sizes.Margin / 2))
         # self._tooltip_action = self.addAction('Toggle Tooltips', checkable=True, connect=self._on_toggle_tooltips)
+        # debug actions are only shown when paint profiler is enabled through its environment variable.
+        if paintprofiler.is_profiler_available():
+            self.addAction(
+                'Profile Paint', checkable=True, checked=False, connect=self._on_toggle_paint_profiler,
+                tooltip='Records how long each widget takes to paint and draws a heatmap on top of the window')
+            self.addAction('Dump Paint Report', connect=self._on_dump_paint_report)
         self.menu_align = Qt.AlignLeft
 
     # def _init_dock_container(self):
@@ -2631,6 +2852,24 @@ class SpawnerIcon(buttons.IconMenuButton):
             else:
                 splitter.moveSplitter(width, pos)
 
+    # noinspection PyUnusedLocal
+    def _on_toggle_paint_profiler(self, tagged_action: QAction, *args):
+        """
+        Internal callback function that is called when Profile Paint action is toggled by the user.
+
+        :param tagged_action: toggled action.
+        """
+
+        self._window.set_paint_profiler_enabled(tagged_action.isChecked())
+
+    # noinspection PyUnusedLocal
+    def _on_dump_paint_report(self, *args):
+        """
+        Internal callback function that is called when Dump Paint Report action is triggered by the user.
+        """
+
+        self._window.dump_paint_report()
+
     # def _on_toggle_tooltips(self, tagged_action: QAction):
     #     """
     #     Internal callback function that is called when Tooltip action is toggled by the user.
@@ -1,12 +1,14 @@
 from __future__ import annotations
 
-from ...externals.Qt.QtCore import Signal, QSize
+from typing import Callable
+
+from ...externals.Qt.QtCore import Signal, QSize, QTimer
 from ...externals.Qt.QtWidgets import (
-    QApplication, QSizePolicy, QWidget, QFrame, QVBoxLayout, QHBoxLayout, QGridLayout, QLabel, QPushButton,
+    QApplication, QSizePolicy, QWidget, QFrame, QLayout, QVBoxLayout, QHBoxLayout, QGridLayout, QLabel, QPushButton,
     QSpacerItem, QCheckBox
 )
 from ...externals.Qt.QtGui import QFont, QIcon, QMouseEvent
-from ...python import paths
+from ... import resources
 from .. import uiconsts, dpi, utils as qtutils
 from . import dividers
 
@@ -23,6 +25,10 @@ class BaseFrame(QFrame):
 class CollapsibleFrame(QWidget):
     """
     Widget for collapsible frame.
+
+    Contents can be built lazily: if a content factory is given, it is called the first time the frame is expanded.
+    Optionally, lazy contents can be released after the frame stays collapsed during the given time and they will be
+    built again on next expand.
     """
 
     _COLLAPSED_ICON: QIcon | None = None
@@ -31,11 +37,16 @@ class CollapsibleFrame(QWidget):
     openRequested = Signal()
     closeRequested = Signal()
     toggled = Signal()
+    contentBuilt = Signal()
+    contentAboutToBeReleased = Signal()
+    contentReleased = Signal()
 
     def __init__(
             self, title: str, collapsed: bool = False, collapsable: bool = True, checkable: bool = False,
             checked: bool = True, content_margins: tuple[int, int, int, int] = uiconsts.MARGINS,
-            content_spacing: int = uiconsts.SPACING, parent: QWidget | None = None):
+            content_spacing: int = uiconsts.SPACING,
+            content_factory: Callable[[CollapsibleFrame], None] | None = None, release_delay: float | None = None,
+            parent: QWidget | None = None):
         """
         Initializes CollapsibleFrame
 
@@ -46,6 +57,12 @@ class CollapsibleFrame(QWidget):
         :param checked: Whether the frame is checked.
         :param content_margins: The content margins.
         :param content_spacing: The content spacing.
+        :param content_factory: Optional function that builds the frame contents (using `add_widget` or `add_layout`
+            functions of the given frame). It is called the first time the frame is expanded.
+        :param release_delay: Optional time in seconds after which lazy contents are released while frame stays
+            collapsed. If None (default), contents are never released. Released widgets are deleted, so only enable it
+            when no code keeps references to them (tools clear their own attributes pointing to released widgets).
+            Values of widgets linked to tool properties are restored by the tool when contents are built again.
         :param parent: The parent widget.
         """
 
@@ -58,6 +75,10 @@ class CollapsibleFrame(QWidget):
         self._checked = checked
         self._content_margins = content_margins
         self._content_spacing = content_spacing
+        self._content_factory = content_factory
+        self._release_delay = release_delay
+        self._content_built = content_factory is None
+        self._release_timer: QTimer | None = None
 
         self._title_frame: BaseFrame | None = None
         self._horizontal_layout: QHBoxLayout | None = None
@@ -69,9 +90,9 @@ class CollapsibleFrame(QWidget):
         self._checkbox: QCheckBox | None = None
 
         if CollapsibleFrame._COLLAPSED_ICON is None:
-            CollapsibleFrame._COLLAPSED_ICON = QIcon(paths.canonical_path('../../resources/icons/arrow_forward.svg'))
+            CollapsibleFrame._COLLAPSED_ICON = resources.icon('arrow_forward')
         if CollapsibleFrame._EXPAND_ICON is None:
-            CollapsibleFrame._EXPAND_ICON = QIcon(paths.canonical_path('../../resources/icons/arrow_expand.svg'))
+            CollapsibleFrame._EXPAND_ICON = resources.icon('arrow_expand')
 
         self._main_layout = QVBoxLayout()
         self._main_layout.setSpacing(0)
@@ -81,6 +102,9 @@ class CollapsibleFrame(QWidget):
         self._setup_ui()
         self._setup_signals()
 
+        if not self._collapsed:
+            self.build_content()
+
     @property
     def hider_layout(self) -> QVBoxLayout:
         """
@@ -109,11 +133,61 @@ class CollapsibleFrame(QWidget):
 
         self._hider_layout.addLayout(layout)
 
+    def is_content_built(self) -> bool:
+        """
+        Returns whether frame contents are built.
+
+        :return: True if contents are built; False if they are waiting to be built by the content factory.
+        """
+
+        return self._content_built
+
+    def build_content(self):
+        """
+        Builds frame contents using the content factory, if they are not built already.
+        """
+
+        if self._content_built:
+            return
+
+        self._content_built = True
+        self.setUpdatesEnabled(False)
+        try:
+            self._content_factory(self)
+        except Exception:
+            # partially built contents are removed, so factory can be called again on next expand.
+            self._clear_layout(self._hider_layout)
+            self._content_built = False
+            raise
+        finally:
+            self.setUpdatesEnabled(True)
+        self.contentBuilt.emit()
+
+    def release_content(self):
+        """
+        Deletes frame contents built by the content factory, so they are built again on next expand.
+        Contents are only released while frame is collapsed.
+
+        ..warning:: released widgets are deleted. Code holding references to them must drop them when
+            `contentAboutToBeReleased` signal is emitted.
+        """
+
+        if self._content_factory is None or not self._content_built or not self._collapsed:
+            return
+
+        self.contentAboutToBeReleased.emit()
+        self._clear_layout(self._hider_layout)
+        self._content_built = False
+        self.contentReleased.emit()
+
     def expand(self):
         """
         Expands/Shows contents.
         """
 
+        if self._release_timer is not None:
+            self._release_timer.stop()
+        self.build_content()
         self.setUpdatesEnabled(False)
         self._hider_widget.show()
         self._icon_button.setIcon(self._EXPAND_ICON)
@@ -135,6 +209,13 @@ class CollapsibleFrame(QWidget):
         self.closeRequested.emit()
         self._collapsed = True
 
+        if self._content_factory is not None and self._release_delay is not None:
+            if self._release_timer is None:
+                self._release_timer = QTimer(parent=self)
+                self._release_timer.setSingleShot(True)
+                self._release_timer.timeout.connect(self.release_content)
+            self._release_timer.start(int(self._release_delay * 1000))
+
     def _setup_ui(self):
         """
         Internal function that setup widgets.
@@ -204,6 +285,24 @@ class CollapsibleFrame(QWidget):
         self._hider_widget.setHidden(self._collapsed)
         self._hider_widget.setEnabled(True if not self._checkable else self._checked)
 
+    def _clear_layout(self, layout: QLayout):
+        """
+        Internal function that removes and deletes all the widgets and layouts within given layout.
+
+        :param layout: layout to clear.
+        """
+
+        while layout.count():
+            item = layout.takeAt(0)
+            widget = item.widget()
+            if widget is not None:
+                widget.hide()
+                widget.setParent(None)
+                widget.deleteLater()
+            elif item.layout() is not None:
+                self._clear_layout(item.layout())
+                item.layout().deleteLater()
+
     def _show_hide_widget(self):
         """
         Internal function that shows/hides the hider widget which contains the contents specified by the user.
@@ -2,10 +2,10 @@ from __future__ import annotations
 
 import enum
 
-from ...externals.Qt.QtCore import Qt, Signal, Property
+from ...externals.Qt.QtCore import Qt, Signal, Property, QSize
 from ...externals.Qt.QtWidgets import QSizePolicy, QWidget, QLabel, QStyleOption
 from ...externals.Qt.QtGui import QIcon, QPainter, QMouseEvent, QResizeEvent, QPaintEvent
-from .. import dpi
+from .. import dpi, refresh, thumbnails
 from . import layouts
 
 
@@ -93,7 +93,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._type = value
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_level(self) -> int:
         """
@@ -112,7 +112,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._level = value
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_underline(self) -> bool:
         """
@@ -131,7 +131,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._underline = flag
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_delete(self) -> bool:
         """
@@ -150,7 +150,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._delete = flag
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_strong(self) -> bool:
         """
@@ -169,7 +169,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._strong = flag
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_mark(self) -> bool:
         """
@@ -188,7 +188,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._mark = flag
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_code(self) -> bool:
         """
@@ -207,7 +207,7 @@ class BaseLabel(QLabel, dpi.DPIScaling):
         """
 
         self._code = flag
-        self.style().polish(self)
+        refresh.refresh_scheduler().restyle(self)
 
     def _get_elide_mode(self) -> Qt.TextElideMode:
         """
@@ -424,7 +424,20 @@ class BaseLabel(QLabel, dpi.DPIScaling):
 
     def _update_elided_text(self):
         """
-        Internal function that updates the elided text on the label
+        Internal function that updates the elided text on the label.
+        Eliding is deferred to the refresh scheduler, so consecutive resizes and text changes within the same event
+        loop iteration only elide the text once.
+        """
+
+        if self._elide_mode == Qt.ElideNone:
+            super().setText(self._actual_text)
+            return
+
+        refresh.refresh_scheduler().refresh(self, self._apply_elided_text)
+
+    def _apply_elided_text(self):
+        """
+        Internal function that elides the label text based on the current label width.
         """
 
         font_metrics = self.fontMetrics()
@@ -497,12 +510,12 @@ class IconLabel(QWidget):
     """
 
     def __init__(
-            self, icon: QIcon, text: str = '', tooltip: str = '', upper: bool = False, bold: bool = False,
+            self, icon: QIcon | str, text: str = '', tooltip: str = '', upper: bool = False, bold: bool = False,
             enable_menu: bool = True, parent: QWidget | None = None):
         """
         Initializes the IconLabel widget.
 
-        :param icon: The icon to display.
+        :param icon: The icon to display or the path of an image file, which is loaded asynchronously.
         :param text: The text to display.
         :param tooltip: The tooltip.
         :param upper: Whether to display the text in uppercase.
@@ -519,10 +532,12 @@ class IconLabel(QWidget):
 
         self._label = BaseLabel(
             text=text, tooltip=tooltip, upper=upper, bold=bold, enable_menu=enable_menu, parent=parent)
-        icon_size = self._label.sizeHint().height()
-        self._icon_pixmap = icon.pixmap(icon_size, icon_size)
         self._icon_label = QLabel(parent=self)
-        self._icon_label.setPixmap(self._icon_pixmap)
+        if isinstance(icon, str):
+            self.set_image(icon)
+        else:
+            icon_size = self._label.sizeHint().height()
+            self._icon_label.setPixmap(icon.pixmap(icon_size, icon_size))
 
         main_layout.addWidget(self._icon_label)
         main_layout.addWidget(self._label)
@@ -537,3 +552,13 @@ class IconLabel(QWidget):
         """
 
         return self._label
+
+    def set_image(self, path: str):
+        """
+        Sets the icon from an image file. Image is loaded asynchronously and a placeholder is shown until it is loaded.
+
+        :param path: image path.
+        """
+
+        icon_size = self._label.sizeHint().height()
+        thumbnails.load_into_label(self._icon_label, path, QSize(icon_size, icon_size))
@@ -3,7 +3,8 @@ from __future__ import annotations
 import typing
 
 from .. import utils
-from ...externals.Qt.QtCore import Qt, Signal, QPoint
+from ...python import fuzzy
+from ...externals.Qt.QtCore import Qt, Signal, QObject, QEvent, QPoint
 from ...externals.Qt.QtWidgets import QMenu, QAction, QWidgetAction
 from ...externals.Qt.QtGui import QIcon, QMouseEvent, QShowEvent
 from .. import dpi
@@ -126,8 +127,12 @@ class SearchableMenu(BaseMenu):
     """
     Extends BaseMenu to make it searchable.
     First action is a QLineEdit used to recursively search on all actions.
+    Tagged actions of the menu and its sub menus are fuzzy matched using an index that is built once and that is
+    updated each time an action is added, changed or removed.
     """
 
+    SEARCH_INDEXED_PROPERTY = 'tpSearchIndexed'
+
     class SearchableTaggedAction(QAction):
         """
         Class that defines a searchable tag action.
@@ -160,6 +165,15 @@ class SearchableMenu(BaseMenu):
 
             self._tags = new_tags
 
+            # Qt 6 renamed associatedWidgets to associatedObjects.
+            associated = self.associatedObjects() if hasattr(self, 'associatedObjects') else self.associatedWidgets()
+            for associated_object in associated:
+                parent = associated_object
+                while parent is not None:
+                    if isinstance(parent, SearchableMenu):
+                        parent.update_action_search_index(self)
+                    parent = parent.parent()
+
         def has_tag(self, tag: str) -> bool:
             """
             Searches this instance tags. Returns True if the tag is valid or False otherwise
@@ -193,6 +207,13 @@ class SearchableMenu(BaseMenu):
 
         self._search_action: QWidgetAction | None = None
         self._search_edit: SearchFindWidget | None = None
+        self._search_index = fuzzy.FuzzyIndex()
+        self._search_index_dirty = True
+
+        # To avoid cyclic imports
+        from . import search
+        self._search_controller = search.FuzzySearchController(self._search_index, match_all=False, parent=self)
+        self._search_controller.resultsReady.connect(self._on_search_results_ready)
 
         self.setObjectName(kwargs.get('objectName', ''))
         self.setTitle(kwargs.get('title', ''))
@@ -211,6 +232,7 @@ class SearchableMenu(BaseMenu):
 
         super().clear()
 
+        self._search_index_dirty = True
         self._init_search_edit()
 
     def showEvent(self, event: QShowEvent):
@@ -251,72 +273,122 @@ class SearchableMenu(BaseMenu):
         :param search_string: tag names separated by spaces (for example, "elem1 elem2")
         """
 
-        def _recursive_search(_menu: QMenu, _search_str: str):
-            """
-            Internal function that recursively searches for menu actions.
+        search_str = str(search_string or '').lower()
+        if not search_str.split():
+            self._search_controller.cancel()
+            utils.recursively_set_menu_actions_visibility(menu=self, state=True)
+            return
 
-            :param _menu: menu to search actions for.
-            :param _search_str: search string.
-            """
+        self._ensure_search_index()
+        self._search_controller.search(search_str)
 
-            for action in _menu.actions():
-                if not search_str:
-                    action.setVisible(True)
-                    continue
-                # This is not valid because for some reason accession QAction menu() attributes makes Qt to
-                # not display the menu anymore. The bug was noticeable in the following scenario:
-                # 1) Type something in the menu search
-                # 2) Navigate inside a Menu
-                # 3) Execute one of the menu items
-                # 4) Now when you open the main menu again all the menus inside it will not appear.
-                # sub_menu = action.menu() if hasattr(action, 'menu') else None
-                # if sub_menu:
-                # _recursive_search(sub_menu, search_str)
-                # continue
-                if action.isSeparator():
-                    continue
-                elif isinstance(action, SearchableMenu.SearchableTaggedAction) and not action.has_tag(search_str):
-                    action.setVisible(False)
-
-            for sub_menu in _menu.findChildren(QMenu):
-                _recursive_search(sub_menu, search_str)
-
-            actions = [action for action in _menu.actions() if not action.isSeparator()]
-            menu_vis = any(action.isVisible() for action in actions)
-            _menu.menuAction().setVisible(menu_vis)
-
-        def _recursive_search_by_tags(_menu: QMenu, _tags: list[str]):
-            """
-            Internal function that recursively searches for menu actions.
+    def update_action_search_index(self, action: QAction):
+        """
+        Updates the search index entry of the given action.
 
-            :param _menu: menu to search actions for.
-            :param _tags: list of tags.
-            """
+        :param action: action to update.
+        """
+
+        if self._search_index_dirty:
+            return
 
-            for action in _menu.actions():
-                sub_menu = action.menu()
-                if sub_menu:
-                    _recursive_search_by_tags(sub_menu, _tags)
-                    continue
-                elif action.isSeparator():
-                    continue
-                elif isinstance(action, SearchableMenu.SearchableTaggedAction):
-                    action.setVisible(action.has_any_tag(_tags))
+        if isinstance(action, SearchableMenu.SearchableTaggedAction):
+            self._search_index.update(action, action.tags)
+        else:
+            self._search_index.remove(action)
 
-            actions = [action for action in _menu.actions() if not action.isSeparator()]
-            menu_vis = any(action.isVisible() for action in actions)
-            _menu.menuAction().setVisible(menu_vis)
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        """
+        Overrides base eventFilter function to keep search index updated with the actions of the menu and its sub
+        menus.
 
-        search_str = str(search_string or '').lower()
-        tags = search_str.split()
-        if not search_str:
-            utils.recursively_set_menu_actions_visibility(menu=self, state=True)
-            return
-        elif len(tags) > 1:
-            _recursive_search_by_tags(self, tags)
+        :param watched: watched object.
+        :param event: event.
+        :return: whether event was handled.
+        """
+
+        if not self._search_index_dirty:
+            event_type = event.type()
+            if event_type in (QEvent.ActionAdded, QEvent.ActionChanged):
+                self.update_action_search_index(event.action())
+            elif event_type == QEvent.ChildAdded:
+                # sub menus are children of their parent menu, so they are indexed as soon as they are created.
+                child = event.child()
+                if isinstance(child, QMenu):
+                    for menu in self._iterate_menus(child):
+                        self._index_menu(menu)
+            elif event_type == QEvent.ActionRemoved:
+                self._search_index.remove(event.action())
+
+        return super().eventFilter(watched, event)
+
+    def _ensure_search_index(self):
+        """
+        Internal function that builds the search index if it is not built yet.
+        """
+
+        if not self._search_index_dirty:
             return
 
-        _recursive_search(self, tags[0])
+        self._search_index.clear()
+        self._search_index_dirty = False
+        for menu in self._iterate_menus(self):
+            self._index_menu(menu)
+
+    def _iterate_menus(self, root: QMenu) -> list[QMenu]:
+        """
+        Internal function that returns the given menu and all its sub menus.
+
+        :param root: menu to get sub menus of.
+        :return: menus, in depth-first pre-order.
+        """
+
+        # Sub menus are found through the children of the menu and not through QAction menu() function, because for
+        # some reason accessing QAction menu() attributes makes Qt to not display the menu anymore. The bug was
+        # noticeable in the following scenario:
+        # 1) Type something in the menu search
+        # 2) Navigate inside a Menu
+        # 3) Execute one of the menu items
+        # 4) Now when you open the main menu again all the menus inside it will not appear.
+        # So, sub menus added with addMenu(menu) must be children of their parent menu to be searchable.
+        return [root] + root.findChildren(QMenu)
+
+    def _index_menu(self, menu: QMenu):
+        """
+        Internal function that indexes the tagged actions of the given menu and watches it, so index is updated when
+        its actions change.
+
+        :param menu: menu to index.
+        """
+
+        for action in menu.actions():
+            if isinstance(action, SearchableMenu.SearchableTaggedAction):
+                self._search_index.update(action, action.tags)
+        if not menu.property(self.SEARCH_INDEXED_PROPERTY):
+            menu.setProperty(self.SEARCH_INDEXED_PROPERTY, True)
+            menu.installEventFilter(self)
+
+    def _on_search_results_ready(self, query: str, results: list[tuple[QAction, int]]):
+        """
+        Internal callback function that is called when a search finishes.
+
+        :param query: search query.
+        :param results: matched actions and their scores.
+        """
+
+        matched_actions = {action for action, _ in results}
+        for action in self._search_index.keys():
+            try:
+                visible = action in matched_actions
+                if action.isVisible() != visible:
+                    action.setVisible(visible)
+            except RuntimeError:
+                # Qt object was already deleted.
+                self._search_index.remove(action)
+
+        for menu in reversed(self._iterate_menus(self)):
+            actions = [action for action in menu.actions() if not action.isSeparator()]
+            menu.menuAction().setVisible(any(action.isVisible() for action in actions))
 
     def _init_search_edit(self):
         """
@@ -331,7 +403,7 @@ class SearchableMenu(BaseMenu):
         self._search_edit = search.SearchFindWidget(parent=self)
         self._search_edit.setStyleSheet('QPushButton {background-color: transparent; border: none;}')
         self._search_edit.set_placeholder_text('Search ...')
-        self._search_edit.textChanged.connect(self._on_update_search)
+        self._search_edit.searchChanged.connect(self._on_update_search)
         self._search_action.setDefaultWidget(self._search_edit)
         self.addAction(self._search_action)
         self.addSeparator()
@@ -0,0 +1,871 @@
+"""
+Virtualized outliner that shows scene hierarchies using a model/view tree.
+
+Benchmark against a standalone scene (from the repository root folder):
+    python -m tp.qt.widgets.outliner --nodes 1000000 --output outliner_benchmark.json
+"""
+
+from __future__ import annotations
+
+import os
+import abc
+import sys
+import json
+import time
+import logging
+import argparse
+from typing import Hashable, Iterable, Any
+
+from ...externals.Qt.QtCore import Qt, QObject, QTimer, QModelIndex, QAbstractItemModel
+from ...externals.Qt.QtWidgets import QWidget, QTreeView, QAbstractItemView
+from ...dcc import callback
+from ...dcc.standalone import callback as standalone_callback
+from ...maya.cmds import filtertypes
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+
+class OutlinerSource(abc.ABC):
+    """
+    Base class that gives outliner models access to the nodes of a scene. Nodes can be any hashable value that
+    identifies a scene node (e.g: a node UUID or a node handle).
+    """
+
+    @abc.abstractmethod
+    def roots(self) -> list[Hashable]:
+        """
+        Returns the nodes at the top of the hierarchy.
+
+        :return: root nodes.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def children(self, node: Hashable) -> list[Hashable]:
+        """
+        Returns the children of the given node.
+
+        :param node: node to get children of.
+        :return: child nodes.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def parent(self, node: Hashable) -> Hashable | None:
+        """
+        Returns the parent of the given node.
+
+        :param node: node to get parent of.
+        :return: parent node or None if node is a root node.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def name(self, node: Hashable) -> str:
+        """
+        Returns the name of the given node.
+
+        :param node: node to get name of.
+        :return: node name.
+        """
+
+        pass
+
+    @abc.abstractmethod
+    def node_type(self, node: Hashable) -> str:
+        """
+        Returns the type of the given node (e.g: transform, mesh or joint).
+
+        :param node: node to get type of.
+        :return: node type.
+        """
+
+        pass
+
+    def has_children(self, node: Hashable) -> bool:
+        """
+        Returns whether given node has children. Sources should override it if children can be checked without
+        listing them.
+
+        :param node: node to check.
+        :return: True if node has children; False otherwise.
+        """
+
+        return bool(self.children(node))
+
+    def node_from_callback(self, *args) -> Hashable | None:
+        """
+        Returns the node the given DCC node callback arguments refer to.
+
+        :param args: DCC specific callback arguments.
+        :return: node or None if arguments do not refer to a node of this source.
+        """
+
+        return args[0] if args else None
+
+
+class StandaloneOutlinerSource(OutlinerSource):
+    """
+    In-memory scene used in standalone sessions. Nodes are integers and node changes are notified through standalone
+    DCC callbacks.
+    """
+
+    GENERATED_TYPES = ('transform', 'mesh', 'joint', 'nurbsCurve', 'locator', 'camera', 'light', 'network')
+
+    def __init__(self):
+        super().__init__()
+
+        self._parents: list[int] = []
+        self._types: list[str] = []
+        self._names: dict[int, str] = {}
+        self._children: dict[int | None, list[int]] = {None: []}
+        self._removed: set[int] = set()
+
+    def __len__(self) -> int:
+        return len(self._parents) - len(self._removed)
+
+    @classmethod
+    def generate(cls, count: int, branching: int = 1000) -> StandaloneOutlinerSource:
+        """
+        Creates a new scene with the given number of nodes. Nodes are created in level order, so each node, but the
+        last ones, have the given number of children. No callbacks are notified.
+
+        :param count: number of nodes to create.
+        :param branching: number of root nodes and of children per node.
+        :return: new standalone scene.
+        """
+
+        scene = cls()
+        types = cls.GENERATED_TYPES
+        scene._parents = [-1 if i < branching else (i - branching) // branching for i in range(count)]
+        scene._types = [types[i % len(types)] for i in range(count)]
+        scene._children[None] = list(range(min(branching, count)))
+        for i in range(branching, count):
+            parent = scene._parents[i]
+            children = scene._children.get(parent)
+            if children is None:
+                children = scene._children[parent] = []
+            children.append(i)
+
+        return scene
+
+    def roots(self) -> list[int]:
+        return list(self._children[None])
+
+    def children(self, node: int) -> list[int]:
+        return list(self._children.get(node, ()))
+
+    def has_children(self, node: int) -> bool:
+        return bool(self._children.get(node))
+
+    def parent(self, node: int) -> int | None:
+        parent = self._parents[node]
+        return None if parent < 0 else parent
+
+    def name(self, node: int) -> str:
+        return self._names.get(node) or f'{self._types[node]}{node}'
+
+    def node_type(self, node: int) -> str:
+        return self._types[node]
+
+    def add_node(self, node_type: str, name: str = '', parent: int | None = None) -> int:
+        """
+        Adds a new node into the scene.
+
+        :param node_type: type of the node.
+        :param name: optional node name.
+        :param parent: optional parent node.
+        :return: new node.
+        """
+
+        node = len(self._parents)
+        self._parents.append(-1 if parent is None else parent)
+        self._types.append(node_type)
+        if name:
+            self._names[node] = name
+        self._children.setdefault(parent, []).append(node)
+        standalone_callback.notify(callback.FnCallback.Callback.NodeAdded, node)
+
+        return node
+
+    def remove_node(self, node: int):
+        """
+        Removes given node and all its descendants from the scene. Removal is notified before removing each node.
+
+        :param node: node to remove.
+        """
+
+        for child in self.children(node):
+            self.remove_node(child)
+
+        standalone_callback.notify(callback.FnCallback.Callback.NodeRemoved, node)
+        self._children[self.parent(node)].remove(node)
+        self._children.pop(node, None)
+        self._names.pop(node, None)
+        self._removed.add(node)
+
+    def rename_node(self, node: int, name: str):
+        """
+        Renames given node.
+
+        :param node: node to rename.
+        :param name: new node name.
+        """
+
+        self._names[node] = name
+        standalone_callback.notify(callback.FnCallback.Callback.NodeRenamed, node)
+
+
+class _OutlinerItem:
+    """
+    Internal class that stores a node exposed by the outliner model.
+    """
+
+    __slots__ = ('node', 'parent', 'row', 'children', 'child_nodes')
+
+    def __init__(self, node: Hashable | None, parent: _OutlinerItem | None, row: int):
+        super().__init__()
+
+        self.node = node
+        self.parent = parent
+        self.row = row
+        self.children: list[_OutlinerItem] = []
+        # child nodes that pass the filter, fetched from the source the first time the item is expanded. Exposed
+        # children always are the first ones.
+        self.child_nodes: list[Hashable] | None = None
+
+
+class OutlinerModel(QAbstractItemModel):
+    """
+    Tree model that exposes the nodes of an outliner source.
+
+    Children are fetched from the source only when their parent is expanded, and exposed to views in batches as views
+    request them through `fetchMore`. Nodes are filtered by type within the model, using the filter types. Node
+    changes notified by DCC callbacks are queued and applied incrementally, once per event loop iteration.
+    """
+
+    FETCH_BATCH_SIZE = 256
+    NodeRole = Qt.UserRole
+    NodeTypeRole = Qt.UserRole + 1
+
+    _ADDED = 0
+    _REMOVED = 1
+    _RENAMED = 2
+
+    def __init__(self, source: OutlinerSource | None = None, parent: QObject | None = None):
+        super().__init__(parent)
+
+        self._source = source
+        self._root = _OutlinerItem(None, None, 0)
+        self._items: dict[Hashable, _OutlinerItem] = {}
+        self._filter_name = filtertypes.ALL_FILTER_TYPE
+        self._filter_types: frozenset[str] | None = None
+        self._callbacks: callback.FnCallback | None = None
+        self._callback_ids: list[tuple[callback.FnCallback.Callback, list[Any]]] = []
+        self._pending_events: list[tuple[int, Hashable, Hashable | None]] = []
+        self._events_timer = QTimer(parent=self)
+        self._events_timer.setSingleShot(True)
+        self._events_timer.setInterval(0)
+        self._events_timer.timeout.connect(self.process_events)
+
+    @property
+    def source(self) -> OutlinerSource | None:
+        """
+        Returns outliner source.
+
+        :return: outliner source.
+        """
+
+        return self._source
+
+    def index(self, row: int, column: int, parent: QModelIndex = QModelIndex()) -> QModelIndex:
+        parent_item = self._item(parent)
+        if column != 0 or row < 0 or row >= len(parent_item.children):
+            return QModelIndex()
+
+        return self.createIndex(row, column, parent_item.children[row])
+
+    # noinspection PyMethodOverriding
+    def parent(self, index: QModelIndex | None = None) -> QModelIndex | QObject:
+        if index is None:
+            return super().parent()
+        if not index.isValid():
+            return QModelIndex()
+
+        parent_item: _OutlinerItem = index.internalPointer().parent
+        if parent_item is None or parent_item is self._root:
+            return QModelIndex()
+
+        return self.createIndex(parent_item.row, 0, parent_item)
+
+    def rowCount(self, parent: QModelIndex = QModelIndex()) -> int:
+        if parent.column() > 0:
+            return 0
+
+        return len(self._item(parent).children)
+
+    def columnCount(self, parent: QModelIndex = QModelIndex()) -> int:
+        return 1
+
+    def hasChildren(self, parent: QModelIndex = QModelIndex()) -> bool:
+        if self._source is None:
+            return False
+
+        item = self._item(parent)
+        if item.child_nodes is not None:
+            return len(item.child_nodes) > 0
+        if item is self._root:
+            return True
+
+        return self._source.has_children(item.node)
+
+    def canFetchMore(self, parent: QModelIndex = QModelIndex()) -> bool:
+        if self._source is None:
+            return False
+
+        item = self._item(parent)
+        if item.child_nodes is None:
+            return True
+
+        return len(item.children) < len(item.child_nodes)
+
+    def fetchMore(self, parent: QModelIndex = QModelIndex()):
+        if self._source is None:
+            return
+
+        item = self._item(parent)
+        self._fetch_child_nodes(item)
+        self._expose(item, parent, len(item.children) + self.FETCH_BATCH_SIZE)
+
+    def data(self, index: QModelIndex, role: Qt.ItemDataRole = Qt.DisplayRole) -> Any:
+        if not index.isValid():
+            return None
+
+        node = index.internalPointer().node
+        if role == Qt.DisplayRole:
+            return self._source.name(node)
+        elif role in (Qt.ToolTipRole, self.NodeTypeRole):
+            return self._source.node_type(node)
+        elif role == self.NodeRole:
+            return node
+
+        return None
+
+    def flags(self, index: QModelIndex) -> Qt.ItemFlags:
+        if not index.isValid():
+            return Qt.NoItemFlags
+
+        return Qt.ItemIsEnabled | Qt.ItemIsSelectable
+
+    def set_source(self, source: OutlinerSource | None):
+        """
+        Sets the source whose nodes are exposed by this model.
+
+        :param source: outliner source.
+        """
+
+        self._source = source
+        self.refresh()
+
+    def refresh(self):
+        """
+        Discards all fetched nodes, so they are fetched again from the source.
+        """
+
+        self.beginResetModel()
+        self._root = _OutlinerItem(None, None, 0)
+        self._items.clear()
+        self._pending_events.clear()
+        self.endResetModel()
+
+    def type_filter(self) -> str:
+        """
+        Returns the name of the current type filter.
+
+        :return: type filter name.
+        """
+
+        return self._filter_name
+
+    def set_type_filter(self, filter_name: str):
+        """
+        Sets the type filter. Nodes whose type does not pass the filter are only shown if they have children, so the
+        nodes that pass the filter can be reached when expanding them.
+
+        :param filter_name: name of the filter within filter types (e.g: Joint).
+        """
+
+        filter_types = filtertypes.TYPE_FILTERS.get(filter_name)
+        if filter_types is None:
+            logger.warning(f'Type filter "{filter_name}" does not exist')
+            return
+
+        self._filter_name = filter_name
+        if filter_types == filtertypes.TYPE_FILTERS[filtertypes.ALL_FILTER_TYPE]:
+            self._filter_types = None
+        else:
+            self._filter_types = frozenset([filter_types] if isinstance(filter_types, str) else filter_types)
+        self.refresh()
+
+    def index_from_node(self, node: Hashable) -> QModelIndex:
+        """
+        Returns the model index of the given node.
+
+        :param node: node to get index of.
+        :return: node index or an invalid index if node was not fetched yet.
+        """
+
+        item = self._items.get(node)
+        return self.createIndex(item.row, 0, item) if item is not None else QModelIndex()
+
+    def fetched_count(self) -> int:
+        """
+        Returns the number of nodes exposed to views.
+
+        :return: exposed nodes count.
+        """
+
+        return len(self._items)
+
+    def connect_callbacks(self, fn_callback: callback.FnCallback | None = None):
+        """
+        Connects to the DCC node callbacks, so model is updated incrementally when nodes are added, removed or
+        renamed.
+
+        :param fn_callback: optional DCC callback function set to register callbacks into.
+        """
+
+        self.disconnect_callbacks()
+        self._callbacks = fn_callback or callback.FnCallback()
+        for callback_type, func in (
+                (self._callbacks.Callback.NodeAdded, self._on_node_added),
+                (self._callbacks.Callback.NodeRemoved, self._on_node_removed),
+                (self._callbacks.Callback.NodeRenamed, self._on_node_renamed)):
+            self._callback_ids.append((callback_type, self._callbacks.add_callback(callback_type, func)))
+
+    def disconnect_callbacks(self):
+        """
+        Disconnects from the DCC node callbacks. Only the callbacks registered by this model are removed, so other
+        owners of the same callback function set keep their callbacks.
+        """
+
+        if self._callbacks is None:
+            return
+
+        for callback_type, callback_ids in self._callback_ids:
+            self._callbacks.remove_callback_ids(callback_type, callback_ids)
+        self._callback_ids = []
+        self._callbacks = None
+
+    def node_added(self, node: Hashable):
+        """
+        Queues the addition of the given node.
+
+        :param node: added node.
+        """
+
+        self._queue_event(self._ADDED, node, None)
+
+    def node_removed(self, node: Hashable):
+        """
+        Queues the removal of the given node. Must be called before node is removed from the source.
+
+        :param node: removed node.
+        """
+
+        parent_node = None
+        try:
+            parent_node = self._source.parent(node)
+        except Exception:
+            item = self._items.get(node)
+            if item is not None and item.parent is not self._root:
+                parent_node = item.parent.node
+        self._queue_event(self._REMOVED, node, parent_node)
+
+    def node_renamed(self, node: Hashable):
+        """
+        Queues the update of the given node name.
+
+        :param node: renamed node.
+        """
+
+        self._queue_event(self._RENAMED, node, None)
+
+    def process_events(self):
+        """
+        Applies all the queued node changes. Consecutive additions are inserted within a single rows insertion per
+        parent.
+        """
+
+        self._events_timer.stop()
+        events, self._pending_events = self._pending_events, []
+        added: dict[int, tuple[_OutlinerItem, list[Hashable]]] = {}
+        added_nodes: set[Hashable] = set()
+        for event, node, parent_node in events:
+            if event == self._ADDED:
+                parent_item = self._parent_item_for_added(node) if node not in added_nodes else None
+                if parent_item is not None:
+                    added.setdefault(id(parent_item), (parent_item, []))[1].append(node)
+                    added_nodes.add(node)
+                continue
+            self._insert_added(added)
+            added_nodes.clear()
+            if event == self._REMOVED:
+                self._remove(node, parent_node)
+            elif event == self._RENAMED:
+                index = self.index_from_node(node)
+                if index.isValid():
+                    self.dataChanged.emit(index, index, [Qt.DisplayRole])
+        self._insert_added(added)
+
+    def _item(self, index: QModelIndex) -> _OutlinerItem:
+        """
+        Internal function that returns the item of the given index.
+
+        :param index: model index.
+        :return: outliner item. Root item is returned for invalid indexes.
+        """
+
+        return index.internalPointer() if index.isValid() else self._root
+
+    def _accepts(self, node: Hashable) -> bool:
+        """
+        Internal function that returns whether given node passes the type filter.
+
+        :param node: node to check.
+        :return: True if node is shown; False otherwise.
+        """
+
+        return (
+            self._filter_types is None or self._source.node_type(node) in self._filter_types or
+            self._source.has_children(node))
+
+    def _filter(self, nodes: Iterable[Hashable]) -> list[Hashable]:
+        """
+        Internal function that returns the given nodes that pass the type filter.
+
+        :param nodes: nodes to filter.
+        :return: filtered nodes.
+        """
+
+        if self._filter_types is None:
+            return list(nodes)
+
+        return [node for node in nodes if self._accepts(node)]
+
+    def _fetch_child_nodes(self, item: _OutlinerItem):
+        """
+        Internal function that fetches the child nodes of the given item from the source, if not fetched yet.
+
+        :param item: item to fetch child nodes of.
+        """
+
+        if item.child_nodes is not None:
+            return
+
+        nodes = self._source.roots() if item is self._root else self._source.children(item.node)
+        item.child_nodes = self._filter(nodes)
+
+    def _expose(self, item: _OutlinerItem, index: QModelIndex, count: int):
+        """
+        Internal function that exposes the fetched child nodes of the given item to views, up to the given count.
+
+        :param item: item to expose children of.
+        :param index: model index of the item.
+        :param count: number of children that should be exposed.
+        """
+
+        first = len(item.children)
+        last = min(count, len(item.child_nodes)) - 1
+        if last < first:
+            return
+
+        self.beginInsertRows(index, first, last)
+        for row in range(first, last + 1):
+            child = _OutlinerItem(item.child_nodes[row], item, row)
+            item.children.append(child)
+            self._items[child.node] = child
+        self.endInsertRows()
+
+    def _index_of(self, item: _OutlinerItem) -> QModelIndex:
+        """
+        Internal function that returns the model index of the given item.
+
+        :param item: outliner item.
+        :return: model index. An invalid index is returned for the root item.
+        """
+
+        return QModelIndex() if item is self._root else self.createIndex(item.row, 0, item)
+
+    def _queue_event(self, event: int, node: Hashable, parent_node: Hashable | None):
+        """
+        Internal function that queues a node change.
+
+        :param event: change type.
+        :param node: changed node.
+        :param parent_node: parent of the changed node, only stored for removals.
+        """
+
+        if self._source is None or node is None:
+            return
+
+        self._pending_events.append((event, node, parent_node))
+        if not self._events_timer.isActive():
+            self._events_timer.start()
+
+    def _parent_item_for_added(self, node: Hashable) -> _OutlinerItem | None:
+        """
+        Internal function that returns the item new node should be inserted into.
+
+        :param node: added node.
+        :return: parent item or None if node does not need to be inserted (its parent children were not fetched yet
+            or node does not pass the filter).
+        """
+
+        if node in self._items:
+            return None
+
+        parent_node = self._source.parent(node)
+        parent_item = self._root if parent_node is None else self._items.get(parent_node)
+        if parent_item is None:
+            return None
+        if parent_item.child_nodes is None:
+            # children will be fetched from the source on expand, only the expand indicator needs to be updated.
+            if parent_item is not self._root:
+                index = self._index_of(parent_item)
+                self.dataChanged.emit(index, index)
+            return None
+        if not self._accepts(node):
+            return None
+
+        return parent_item
+
+    def _insert_added(self, added: dict[int, tuple[_OutlinerItem, list[Hashable]]]):
+        """
+        Internal function that inserts the given added nodes, clearing the given dictionary.
+
+        :param added: dictionary with the parent item ids as keys and the parent item and added nodes as values.
+        """
+
+        for parent_item, nodes in added.values():
+            fully_exposed = len(parent_item.children) == len(parent_item.child_nodes)
+            parent_item.child_nodes.extend(nodes)
+            if fully_exposed:
+                self._expose(parent_item, self._index_of(parent_item), len(parent_item.child_nodes))
+        added.clear()
+
+    def _remove(self, node: Hashable, parent_node: Hashable | None):
+        """
+        Internal function that removes given node from the model.
+
+        :param node: removed node.
+        :param parent_node: parent of the removed node.
+        """
+
+        item = self._items.get(node)
+        if item is None:
+            parent_item = self._root if parent_node is None else self._items.get(parent_node)
+            if parent_item is not None and parent_item.child_nodes is not None:
+                try:
+                    parent_item.child_nodes.remove(node)
+                except ValueError:
+                    pass
+            return
+
+        parent_item = item.parent
+        row = item.row
+        self.beginRemoveRows(self._index_of(parent_item), row, row)
+        parent_item.children.pop(row)
+        parent_item.child_nodes.pop(row)
+        for sibling in parent_item.children[row:]:
+            sibling.row -= 1
+        self._forget(item)
+        self.endRemoveRows()
+
+    def _forget(self, item: _OutlinerItem):
+        """
+        Internal function that removes given item and all its descendants from the fetched items.
+
+        :param item: item to forget.
+        """
+
+        stack = [item]
+        while stack:
+            found_item = stack.pop()
+            self._items.pop(found_item.node, None)
+            stack.extend(found_item.children)
+
+    def _on_node_added(self, *args):
+        """
+        Internal callback function that is called each time DCC notifies a new node.
+
+        :param args: DCC specific callback arguments.
+        """
+
+        if self._source is not None:
+            self.node_added(self._source.node_from_callback(*args))
+
+    def _on_node_removed(self, *args):
+        """
+        Internal callback function that is called each time DCC notifies a node removal.
+
+        :param args: DCC specific callback arguments.
+        """
+
+        if self._source is not None:
+            self.node_removed(self._source.node_from_callback(*args))
+
+    def _on_node_renamed(self, *args):
+        """
+        Internal callback function that is called each time DCC notifies a node rename.
+
+        :param args: DCC specific callback arguments.
+        """
+
+        if self._source is not None:
+            self.node_renamed(self._source.node_from_callback(*args))
+
+
+class OutlinerView(QTreeView):
+    """
+    Tree view that shows an outliner model. All rows have the same height, so view only lays out the visible rows.
+    """
+
+    def __init__(self, model: OutlinerModel | None = None, parent: QWidget | None = None):
+        super().__init__(parent)
+
+        self.setUniformRowHeights(True)
+        self.setHeaderHidden(True)
+        self.setSelectionMode(QAbstractItemView.ExtendedSelection)
+        self.setVerticalScrollMode(QAbstractItemView.ScrollPerPixel)
+        if model is not None:
+            self.setModel(model)
+
+    def selected_nodes(self) -> list[Hashable]:
+        """
+        Returns the nodes of the selected rows.
+
+        :return: selected nodes.
+        """
+
+        return [index.data(OutlinerModel.NodeRole) for index in self.selectionModel().selectedRows()]
+
+
+def benchmark(node_count: int = 1000000, branching: int = 1000, events: int = 10000) -> dict:
+    """
+    Measures outliner performance against a standalone scene.
+
+    :param node_count: number of scene nodes.
+    :param branching: number of root nodes and of children per node.
+    :param events: number of node additions notified through DCC callbacks.
+    :return: benchmark report, with times in milliseconds.
+    """
+
+    from ...externals.Qt.QtWidgets import QApplication
+
+    def _measure(func: callable) -> float:
+        start = time.perf_counter()
+        func()
+        QApplication.processEvents()
+        return (time.perf_counter() - start) * 1000.0
+
+    report: dict[str, Any] = {'nodes': node_count, 'branching': branching, 'events': events}
+
+    start = time.perf_counter()
+    scene = StandaloneOutlinerSource.generate(node_count, branching=branching)
+    report['generate_scene_ms'] = (time.perf_counter() - start) * 1000.0
+
+    model = OutlinerModel()
+    view = OutlinerView(model)
+    view.resize(400, 800)
+
+    def _set_source():
+        model.set_source(scene)
+
+    def _first_show():
+        view.show()
+        view.grab()
+
+    def _expand():
+        for row in range(min(100, model.rowCount())):
+            view.expand(model.index(row, 0))
+        view.grab()
+
+    def _scroll_to_bottom():
+        view.scrollToBottom()
+        view.grab()
+
+    def _filter():
+        model.set_type_filter(filtertypes.JOINT_FILTER_TYPE)
+        view.grab()
+
+    def _clear_filter():
+        model.set_type_filter(filtertypes.ALL_FILTER_TYPE)
+        view.grab()
+
+    def _add_nodes():
+        roots = scene.roots()
+        for i in range(events):
+            scene.add_node('transform', parent=roots[i % len(roots)])
+        model.process_events()
+        view.grab()
+
+    report['set_source_ms'] = _measure(_set_source)
+    report['first_show_ms'] = _measure(_first_show)
+    report['expand_100_ms'] = _measure(_expand)
+    report['scroll_to_bottom_ms'] = _measure(_scroll_to_bottom)
+    report['filter_ms'] = _measure(_filter)
+    report['clear_filter_ms'] = _measure(_clear_filter)
+    model.connect_callbacks()
+    report['node_added_events_ms'] = _measure(_add_nodes)
+    model.disconnect_callbacks()
+    report['fetched_items'] = model.fetched_count()
+
+    view.deleteLater()
+    QApplication.processEvents()
+
+    return report
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Benchmarks tp-dcc outliner against a standalone scene.')
+    parser.add_argument('--nodes', type=int, default=1000000, help='Number of scene nodes.')
+    parser.add_argument('--branching', type=int, default=1000, help='Number of roots and children per node.')
+    parser.add_argument('--events', type=int, default=10000, help='Number of node added events.')
+    parser.add_argument('--output', default='', help='Optional JSON file path to write the report to.')
+    parsed_args = parser.parse_args(args)
+
+    os.environ.setdefault('QT_QPA_PLATFORM', 'offscreen')
+    from ...externals.Qt.QtWidgets import QApplication
+    app = QApplication.instance() or QApplication(sys.argv[:1])
+
+    report = benchmark(node_count=parsed_args.nodes, branching=parsed_args.branching, events=parsed_args.events)
+    print(json.dumps(report, indent=4))
+    if parsed_args.output:
+        with open(parsed_args.output, 'w') as f:
+            json.dump(report, f, indent=4)
+        logger.info(f'Benchmark report written to: {parsed_args.output}')
+    del app
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
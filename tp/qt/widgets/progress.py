@@ -0,0 +1,129 @@
+from __future__ import annotations
+
+from ...externals.Qt.QtCore import Qt, QObject
+from ...externals.Qt.QtWidgets import QWidget, QProgressBar
+from .. import uiconsts
+from . import layouts, labels, buttons
+
+
+class TaskProgressWidget(QWidget):
+    """
+    Widget that shows the progress of a running task and allows the user to cancel it.
+
+    Any object that defines `label` attribute, `progressChanged(int, int)`, `messageChanged(str)` and `finished(bool)`
+    signals and a `cancel` function can be tracked (e.g: tp.core.task.ChunkedTask). Widget is hidden while no task is
+    tracked.
+    """
+
+    def __init__(self, parent: QWidget | None = None):
+        super().__init__(parent)
+
+        self._task: QObject | None = None
+
+        main_layout = layouts.HorizontalLayout()
+        main_layout.setContentsMargins(*uiconsts.MARGINS)
+        main_layout.setSpacing(uiconsts.SPACING)
+        self.setLayout(main_layout)
+
+        self._label = labels.BaseLabel(parent=self, elide_mode=Qt.ElideRight)
+        self._progress_bar = QProgressBar(parent=self)
+        self._progress_bar.setTextVisible(True)
+        self._cancel_button = buttons.BasePushButton(text='Cancel', parent=self)
+        main_layout.addWidget(self._label, 1)
+        main_layout.addWidget(self._progress_bar, 2)
+        main_layout.addWidget(self._cancel_button)
+
+        self._cancel_button.clicked.connect(self._on_cancel_button_clicked)
+
+        self.setVisible(False)
+
+    @property
+    def task(self) -> QObject | None:
+        """
+        Returns tracked task.
+
+        :return: tracked task.
+        """
+
+        return self._task
+
+    def set_task(self, task: QObject | None):
+        """
+        Sets the task whose progress is shown.
+
+        :param task: task to track. If None, widget is hidden.
+        """
+
+        if self._task is not None:
+            try:
+                self._task.progressChanged.disconnect(self._on_task_progress_changed)
+                self._task.messageChanged.disconnect(self._label.setText)
+                self._task.finished.disconnect(self._on_task_finished)
+            except (RuntimeError, TypeError):
+                pass
+
+        self._task = task
+        if task is None:
+            self.setVisible(False)
+            return
+
+        self._label.setText(getattr(task, 'label', ''))
+        self._progress_bar.setRange(0, 0)
+        self._progress_bar.setVisible(True)
+        self._cancel_button.setText('Cancel')
+        self._cancel_button.setEnabled(True)
+        task.progressChanged.connect(self._on_task_progress_changed)
+        task.messageChanged.connect(self._label.setText)
+        task.finished.connect(self._on_task_finished)
+        self.setVisible(True)
+
+    def show_error(self, message: str):
+        """
+        Stops tracking current task and shows given error message until the user dismisses it.
+
+        :param message: error message to show.
+        """
+
+        self.set_task(None)
+        self._label.setText(message)
+        self._label.setToolTip(message)
+        self._progress_bar.setVisible(False)
+        self._cancel_button.setText('Dismiss')
+        self._cancel_button.setEnabled(True)
+        self.setVisible(True)
+
+    def _on_task_progress_changed(self, done: int, total: int):
+        """
+        Internal callback function that is called each time tracked task progress changes.
+
+        :param done: number of processed items.
+        :param total: total number of items.
+        """
+
+        if self._progress_bar.maximum() != total:
+            self._progress_bar.setRange(0, total)
+        self._progress_bar.setValue(done)
+
+    # noinspection PyUnusedLocal
+    def _on_task_finished(self, succeeded: bool):
+        """
+        Internal callback function that is called when tracked task finishes.
+
+        :param succeeded: whether task completed without being cancelled.
+        """
+
+        self.set_task(None)
+
+    def _on_cancel_button_clicked(self):
+        """
+        Internal callback function that is called when Cancel button is clicked by the user.
+        """
+
+        if self._task is None:
+            # error message is being shown.
+            self.setVisible(False)
+            return
+
+        self._cancel_button.setEnabled(False)
+        self._label.setText('Cancelling...')
+        self._task.cancel()
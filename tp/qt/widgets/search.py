@@ -1,9 +1,10 @@
 from __future__ import annotations
 
 from .. import dpi
-from ...python import paths
+from ... import resources
+from ...python import fuzzy
 from ..widgets import layouts, buttons
-from ...externals.Qt.QtCore import Qt, QObject, Signal, QSize, QEvent
+from ...externals.Qt.QtCore import Qt, QObject, Signal, QSize, QEvent, QTimer
 from ...externals.Qt.QtWidgets import QWidget, QLineEdit, QToolButton, QStyle
 from ...externals.Qt.QtGui import QPixmap, QIcon, QResizeEvent, QKeyEvent, QFocusEvent
 
@@ -16,11 +17,16 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
 
     Signals:
     textChanged (str): Emitted when the text is changed.
+    searchChanged (str): Emitted when the text is changed and the user stopped typing for the debounce interval.
+        Emitted immediately when text is cleared.
     editingFinished (str): Emitted when editing is finished.
     returnPressed (): Emitted when the return key is pressed.
     """
 
+    DEFAULT_DEBOUNCE_INTERVAL = 150
+
     textChanged = Signal(str)
+    searchChanged = Signal(str)
     editingFinished = Signal(str)
     returnPressed = Signal()
 
@@ -48,14 +54,14 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
             icon_size = 62
 
         self._clear_button = buttons.IconMenuButton(parent=self)
-        self._clear_button.setIcon(QIcon(paths.canonical_path('../../resources/icons/close.png')))
+        self._clear_button.setIcon(resources.icon('close'))
         self._clear_button.setIconSize(QSize(icon_size - 6, icon_size - 6))
         self._clear_button.setFixedSize(QSize(icon_size, icon_size))
         self._clear_button.setFocusPolicy(Qt.NoFocus)
         self._clear_button.hide()
         self._search_button = buttons.IconMenuButton(parent=self)
         self._search_button.setAttribute(Qt.WA_TransparentForMouseEvents, True)
-        self._search_button.setIcon(QIcon(paths.canonical_path('../../resources/icons/search.png')))
+        self._search_button.setIcon(resources.icon('search'))
         self._search_button.setIconSize(QSize(icon_size, icon_size))
         self._search_button.setFixedSize(QSize(icon_size, icon_size))
         self._search_button.setEnabled(True)
@@ -67,10 +73,16 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
             """ % (self._search_button_padded_width(), self._clear_button_padded_width())
         )
 
+        self._debounce_timer = QTimer(parent=self)
+        self._debounce_timer.setSingleShot(True)
+        self._debounce_timer.setInterval(self.DEFAULT_DEBOUNCE_INTERVAL)
+
         self.update_minimum_size()
 
         self.layout().addWidget(self._search_line)
 
+        self.setup_signals()
+
     def setup_signals(self):
         """
         Function that connects signals for all widget UI widgets.
@@ -78,7 +90,9 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
 
         self._search_line.textChanged.connect(self.textChanged.emit)
         self._search_line.textChanged.connect(self.set_text)
+        self._search_line.textChanged.connect(self._on_search_line_text_changed)
         self._clear_button.clicked.connect(self.clear)
+        self._debounce_timer.timeout.connect(self._on_debounce_timer_timeout)
 
     @property
     def search_line(self):
@@ -223,6 +237,24 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
         if focus:
             self.set_focus()
 
+    def debounce_interval(self) -> int:
+        """
+        Returns the time the user must stop typing before searchChanged signal is emitted.
+
+        :return: debounce interval in milliseconds.
+        """
+
+        return self._debounce_timer.interval()
+
+    def set_debounce_interval(self, interval: int):
+        """
+        Sets the time the user must stop typing before searchChanged signal is emitted.
+
+        :param interval: debounce interval in milliseconds.
+        """
+
+        self._debounce_timer.setInterval(interval)
+
     def select_all(self):
         """
         Selects all search line edit text.
@@ -294,6 +326,112 @@ class SearchFindWidget(QWidget, dpi.DPIScaling):
 
         return self._search_button.height() + self._search_line_frame_width() * 2
 
+    def _on_search_line_text_changed(self, text: str):
+        """
+        Internal callback function that is called each time search line text changes.
+
+        :param text: search text.
+        """
+
+        if text:
+            self._debounce_timer.start()
+            return
+
+        self._debounce_timer.stop()
+        self.searchChanged.emit(text)
+
+    def _on_debounce_timer_timeout(self):
+        """
+        Internal callback function that is called when user stopped typing for the debounce interval.
+        """
+
+        self.searchChanged.emit(self.get_text())
+
+
+class FuzzySearchController(QObject):
+    """
+    Class that runs fuzzy searches over an index without blocking the UI. Candidates are scored in steps that fit
+    within a frame budget and running searches are cancelled as soon as a new search is requested.
+
+    Signals:
+    resultsReady (str, list[tuple[Hashable, int]]): Emitted with the query and its results, sorted from best to worst
+        match, when search finishes.
+    """
+
+    FRAME_BUDGET = 0.008
+
+    resultsReady = Signal(str, object)
+
+    def __init__(
+            self, index: fuzzy.FuzzyIndex | None = None, match_all: bool = True, limit: int | None = None,
+            parent: QObject | None = None):
+        super().__init__(parent)
+
+        self._index = index if index is not None else fuzzy.FuzzyIndex()
+        self._match_all = match_all
+        self._limit = limit
+        self._job: fuzzy.FuzzySearchJob | None = None
+        self._timer = QTimer(parent=self)
+        self._timer.setInterval(0)
+        self._timer.timeout.connect(self._on_timer_timeout)
+
+    @property
+    def index(self) -> fuzzy.FuzzyIndex:
+        """
+        Returns the index searches are run against.
+
+        :return: fuzzy index.
+        """
+
+        return self._index
+
+    def search(self, query: str):
+        """
+        Starts a new search, cancelling the running one. If search can be finished within the frame budget, results
+        are emitted immediately.
+
+        :param query: search query.
+        """
+
+        self.cancel()
+        self._job = fuzzy.FuzzySearchJob(self._index, query, match_all=self._match_all)
+        if self._job.step(self.FRAME_BUDGET):
+            self._finish()
+        else:
+            self._timer.start()
+
+    def cancel(self):
+        """
+        Cancels running search, if any.
+        """
+
+        self._timer.stop()
+        if self._job is not None:
+            self._job.cancel()
+            self._job = None
+
+    def _finish(self):
+        """
+        Internal function that emits the results of the running search.
+        """
+
+        job = self._job
+        self._job = None
+        self._timer.stop()
+        self.resultsReady.emit(job.query, job.results(self._limit))
+
+    def _on_timer_timeout(self):
+        """
+        Internal callback function that scores the next candidates of the running search.
+        """
+
+        if self._job is None or self._job.cancelled:
+            self._timer.stop()
+            return
+
+        if self._job.step(self.FRAME_BUDGET):
+            self._finish()
+
 
 class ClearToolButton(QToolButton):
     """
@@ -327,8 +465,8 @@ class SearchLineEdit(QLineEdit, dpi.DPIScaling):
         # self._theme_pref = core.theme_preference_interface()
         self._background_color = None
 
-        clear_pixmap = clear_pixmap or QPixmap(paths.canonical_path('../../resources/icons/close.png'))
-        search_pixmap = search_pixmap or QPixmap(paths.canonical_path('../../resources/icons/search.png'))
+        clear_pixmap = clear_pixmap or resources.pixmap('close')
+        search_pixmap = search_pixmap or resources.pixmap('search')
         # clear_pixmap = clear_pixmap or resources.pixmap('close', size=dpi.dpi_scale(16), color=(128, 128, 128))
         # search_pixmap = search_pixmap or resources.pixmap('search', size=dpi.dpi_scale(16), color=(128, 128, 128))
         self._clear_button = ClearToolButton(parent=self)
@@ -0,0 +1,139 @@
+from __future__ import annotations
+
+from typing import Callable
+
+from .. import dpi
+from ...externals.Qt.QtCore import Qt, Signal, QObject, QEvent, QRect, QTimer
+from ...externals.Qt.QtWidgets import QApplication, QWidget
+from ...externals.Qt.QtGui import QColor, QFont, QPainter, QPaintEvent
+
+
+class FirstPaintWatcher(QObject):
+    """
+    Class that calls a function once, right after the first time the watched widget is painted.
+
+    Function is called from the next event loop iteration, so painted contents are already on screen.
+    """
+
+    def __init__(self, widget: QWidget, callback: Callable[[], None]):
+        super().__init__(widget)
+
+        self._callback = callback
+        self._done = False
+        widget.installEventFilter(self)
+
+    def eventFilter(self, watched: QObject, event: QEvent) -> bool:
+        """
+        Overrides base eventFilter function to detect watched widget first paint.
+
+        :param watched: watched widget.
+        :param event: Qt event.
+        :return: False, so event is always processed by the widget.
+        """
+
+        if not self._done and event.type() == QEvent.Paint:
+            self._done = True
+            watched.removeEventFilter(self)
+            QTimer.singleShot(0, self._callback)
+
+        return False
+
+
+def call_after_first_paint(widget: QWidget, callback: Callable[[], None]) -> FirstPaintWatcher:
+    """
+    Calls given function once, right after the first time the given widget is painted.
+
+    :param widget: widget to watch.
+    :param callback: function to call.
+    :return: first paint watcher. It is parented to the widget, so it does not need to be kept alive.
+    """
+
+    return FirstPaintWatcher(widget, callback)
+
+
+class SplashWindow(QWidget):
+    """
+    Lightweight frameless window that is shown while a tool is loading.
+
+    It is painted manually and only depends on Qt, so it can be shown before theme stylesheets, icon resources and
+    widget modules are loaded.
+    """
+
+    BACKGROUND_COLOR = QColor(45, 45, 45)
+    BORDER_COLOR = QColor(30, 30, 30)
+    TITLE_COLOR = QColor(220, 220, 220)
+    MESSAGE_COLOR = QColor(150, 150, 150)
+    WIDTH = 360
+    HEIGHT = 120
+
+    firstPainted = Signal()
+
+    def __init__(self, title: str = '', message: str = 'Loading...', parent: QWidget | None = None):
+        super().__init__(parent)
+
+        self._title = title
+        self._message = message
+        self._painted = False
+
+        self.setWindowFlags(Qt.Window | Qt.FramelessWindowHint | Qt.WindowStaysOnTopHint)
+        self.setAttribute(Qt.WA_OpaquePaintEvent)
+        self.setWindowTitle(title)
+        self.setFixedSize(int(dpi.dpi_scale(self.WIDTH)), int(dpi.dpi_scale(self.HEIGHT)))
+
+    def set_message(self, message: str):
+        """
+        Sets the loading message and repaints the window immediately, so it is updated even when the caller blocks
+        the event loop right after.
+
+        :param message: loading message.
+        """
+
+        self._message = message
+        if self.isVisible():
+            self.repaint()
+
+    def show_centered(self):
+        """
+        Shows the window centered within the primary screen.
+        """
+
+        screen = QApplication.primaryScreen()
+        if screen is not None:
+            geometry = self.frameGeometry()
+            geometry.moveCenter(screen.availableGeometry().center())
+            self.move(geometry.topLeft())
+        self.show()
+
+    def paintEvent(self, event: QPaintEvent):
+        """
+        Overrides base paintEvent function to draw the window title and the loading message.
+
+        :param event: Qt paint event.
+        """
+
+        painter = QPainter(self)
+        try:
+            rect = self.rect()
+            painter.fillRect(rect, self.BACKGROUND_COLOR)
+            painter.setPen(self.BORDER_COLOR)
+            painter.drawRect(rect.adjusted(0, 0, -1, -1))
+
+            margin = int(dpi.dpi_scale(16))
+            text_rect = rect.adjusted(margin, margin, -margin, -margin)
+            font = QFont(self.font())
+            font.setPointSizeF(font.pointSizeF() * 1.5)
+            font.setBold(True)
+            painter.setFont(font)
+            painter.setPen(self.TITLE_COLOR)
+            painter.drawText(text_rect, Qt.AlignLeft | Qt.AlignTop, self._title)
+            painter.setFont(self.font())
+            painter.setPen(self.MESSAGE_COLOR)
+            painter.drawText(
+                QRect(text_rect), Qt.AlignLeft | Qt.AlignBottom | Qt.TextSingleLine,
+                painter.fontMetrics().elidedText(self._message, Qt.ElideRight, text_rect.width()))
+        finally:
+            painter.end()
+
+        if not self._painted:
+            self._painted = True
+            self.firstPainted.emit()
@@ -0,0 +1,113 @@
+from __future__ import annotations
+
+import os
+
+from ..externals.Qt.QtCore import Qt, QSize
+from ..externals.Qt.QtGui import QColor, QIcon, QPixmap
+
+# Resource paths are resolved only once, when this module is imported.
+RESOURCES_PATH = os.path.dirname(os.path.abspath(__file__)).replace('\\', '/')
+ICONS_PATH = f'{RESOURCES_PATH}/icons'
+ICON_EXTENSIONS = ('.png', '.svg')
+
+_ICON_PATHS: dict[str, str] = {}
+_ICONS_CACHE: dict[tuple[str, int | None], QIcon] = {}
+_PIXMAPS_CACHE: dict[tuple[str, int | None, tuple[int, ...] | None], QPixmap] = {}
+
+
+def _register_icons(icons_path: str = ICONS_PATH):
+    """
+    Internal function that registers all the icon files located within the given folder by their logical name
+    (the file name without extension).
+
+    :param icons_path: absolute folder path containing icon files.
+    """
+
+    if not os.path.isdir(icons_path):
+        return
+
+    for entry in os.scandir(icons_path):
+        name, extension = os.path.splitext(entry.name)
+        if extension.lower() in ICON_EXTENSIONS and name not in _ICON_PATHS:
+            _ICON_PATHS[name] = entry.path.replace('\\', '/')
+
+
+def resource_path(relative_path: str) -> str:
+    """
+    Returns the absolute path of a resource file from its path relative to tp resources folder.
+
+    :param relative_path: resource path relative to tp resources folder (e.g: icons/close.png).
+    :return: absolute resource path.
+    """
+
+    return f'{RESOURCES_PATH}/{relative_path.lstrip("/")}'
+
+
+def icon_path(name: str) -> str:
+    """
+    Returns the absolute path of the icon file with given logical name.
+
+    :param name: icon logical name (e.g: close).
+    :return: absolute icon path or an empty string if icon is not registered.
+    """
+
+    return _ICON_PATHS.get(name, '')
+
+
+def icon(name: str, size: int | None = None) -> QIcon:
+    """
+    Returns cached icon instance for the icon with given logical name.
+
+    :param name: icon logical name (e.g: close).
+    :param size: optional icon size (before DPI scaling) the icon is displayed with.
+    :return: icon instance. A null icon is returned if icon with given name is not registered.
+    ..note:: if size is given and icons atlas contains that size, icon contains all the pre-rasterized DPI variants.
+        Otherwise, icon file is used, so icons are never upscaled from a smaller raster.
+    """
+
+    key = (name, size)
+    found_icon = _ICONS_CACHE.get(key)
+    if found_icon is not None:
+        return found_icon
+
+    found_icon = None
+    if size is not None:
+        from ..qt import icon as qt_icon
+        found_icon = qt_icon.atlas_icon(f'icons/{name}', size=size)
+    found_icon = found_icon or QIcon(icon_path(name))
+    _ICONS_CACHE[key] = found_icon
+
+    return found_icon
+
+
+def pixmap(
+        name: str, size: int | None = None, color: tuple[int, int, int] | QColor | None = None) -> QPixmap:
+    """
+    Returns cached pixmap instance for the icon with given logical name.
+
+    :param name: icon logical name (e.g: close).
+    :param size: optional pixmap size in pixels. If not given, pixmap is returned with its original size.
+    :param color: optional color to colorize pixmap with.
+    :return: pixmap instance.
+    """
+
+    color_key = None
+    if color is not None:
+        color_key = tuple(color.getRgb()) if isinstance(color, QColor) else tuple(color)
+    key = (name, int(size) if size else None, color_key)
+    found_pixmap = _PIXMAPS_CACHE.get(key)
+    if found_pixmap is not None:
+        return found_pixmap
+
+    found_pixmap = QPixmap(icon_path(name))
+    if size and not found_pixmap.isNull():
+        found_pixmap = found_pixmap.scaled(QSize(int(size), int(size)), Qt.KeepAspectRatio, Qt.SmoothTransformation)
+    if color is not None:
+        from ..qt import pixmap as qt_pixmap
+        found_pixmap = qt_pixmap.colorize_pixmap(found_pixmap, color)
+    _PIXMAPS_CACHE[key] = found_pixmap
+
+    return found_pixmap
+
+
+_register_icons()
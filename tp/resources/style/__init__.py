@@ -6,6 +6,9 @@ import inspect
 from ...externals.Qt.QtCore import QResource
 
 RESOURCE_REGISTERED = False
+# icons atlas files are generated by build_atlas build step (see compile_rcc.bat).
+ATLAS_IMAGE_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'atlas', 'icons_atlas.png')
+ATLAS_INDEX_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'atlas', 'icons_atlas.json')
 
 
 def style_file_path() -> str:
@@ -0,0 +1,170 @@
+"""
+Build step that pre-rasterizes all tp-dcc icons at every DPI scale factor and packs them into a single atlas image
+plus a JSON index. Generated files are stored within the atlas folder, where they are loaded from at runtime.
+
+Usage (from the repository root folder):
+    python -m tp.resources.style.build_atlas
+"""
+
+from __future__ import annotations
+
+import os
+import sys
+import json
+import logging
+import argparse
+
+from ...qt import dpi
+from ...externals.Qt.QtCore import Qt, QRectF
+from ...externals.Qt.QtGui import QGuiApplication, QImage, QPainter
+from ...externals.Qt.QtSvg import QSvgRenderer
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+ATLAS_VERSION = 1
+ATLAS_WIDTH = 2048
+ATLAS_PADDING = 1
+ATLAS_BASE_SIZES = (16, 24)
+ATLAS_EXTENSIONS = ('.svg', '.png')
+STYLE_PATH = os.path.dirname(os.path.abspath(__file__))
+RESOURCES_PATH = os.path.dirname(STYLE_PATH)
+ATLAS_PATH = os.path.join(STYLE_PATH, 'atlas')
+ICONS_PATHS = (os.path.join(RESOURCES_PATH, 'icons'), os.path.join(STYLE_PATH, 'icons'))
+
+
+def icon_files(icons_paths: tuple[str, ...] = ICONS_PATHS) -> dict[str, str]:
+    """
+    Returns all icon files that should be packed into the atlas.
+
+    :param icons_paths: folders to look for icons in.
+    :return: dictionary with the logical icon names as keys and the absolute icon file paths as values. Logical names
+        are the icon paths relative to tp resources folder without extension (e.g: icons/close, style/icons/check).
+    """
+
+    found_icons: dict[str, str] = {}
+    for icons_path in icons_paths:
+        if not os.path.isdir(icons_path):
+            continue
+        for file_name in sorted(os.listdir(icons_path)):
+            base_name, extension = os.path.splitext(file_name)
+            if extension.lower() not in ATLAS_EXTENSIONS:
+                continue
+            relative_folder = os.path.relpath(icons_path, RESOURCES_PATH).replace('\\', '/')
+            found_icons[f'{relative_folder}/{base_name}'] = os.path.join(icons_path, file_name)
+
+    return found_icons
+
+
+def rasterize(file_path: str, size: int) -> QImage:
+    """
+    Rasterizes given icon file into a squared image of the given size.
+
+    :param file_path: absolute path to the SVG or PNG icon file.
+    :param size: size in pixels of the image.
+    :return: rasterized image.
+    """
+
+    image = QImage(size, size, QImage.Format_ARGB32_Premultiplied)
+    image.fill(Qt.transparent)
+    painter = QPainter(image)
+    painter.setRenderHint(QPainter.Antialiasing)
+    painter.setRenderHint(QPainter.SmoothPixmapTransform)
+    if file_path.lower().endswith('.svg'):
+        QSvgRenderer(file_path).render(painter, QRectF(0, 0, size, size))
+    else:
+        source = QImage(file_path).scaled(size, size, Qt.KeepAspectRatio, Qt.SmoothTransformation)
+        painter.drawImage(int((size - source.width()) / 2), int((size - source.height()) / 2), source)
+    painter.end()
+
+    return image
+
+
+def build(
+        output_path: str = ATLAS_PATH, base_sizes: tuple[int, ...] = ATLAS_BASE_SIZES,
+        scale_factors: tuple[float, ...] = dpi.SCALE_FACTORS, width: int = ATLAS_WIDTH) -> tuple[str, str]:
+    """
+    Rasterizes all icons and packs them into an atlas image and its JSON index.
+
+    Images are packed using shelves: rasterized icons are sorted by size and placed from left to right, starting a
+    new shelf when current one is full.
+
+    :param output_path: folder where atlas image and index files will be stored.
+    :param base_sizes: icon sizes (before DPI scaling) that will be rasterized.
+    :param scale_factors: DPI scale factors to rasterize each base size with.
+    :param width: atlas image width in pixels.
+    :return: tuple containing the atlas image and the atlas index file paths.
+    """
+
+    entries: list[tuple[str, int, float, QImage]] = []
+    for name, file_path in icon_files().items():
+        for base_size in base_sizes:
+            for scale_factor in scale_factors:
+                size = int(round(base_size * scale_factor))
+                entries.append((name, base_size, scale_factor, rasterize(file_path, size)))
+    entries.sort(key=lambda entry: entry[3].height(), reverse=True)
+
+    rects: list[tuple[int, int, int, int]] = []
+    x = y = shelf_height = 0
+    for _, _, _, image in entries:
+        if x + image.width() > width:
+            x = 0
+            y += shelf_height + ATLAS_PADDING
+            shelf_height = 0
+        rects.append((x, y, image.width(), image.height()))
+        x += image.width() + ATLAS_PADDING
+        shelf_height = max(shelf_height, image.height())
+
+    atlas = QImage(width, max(y + shelf_height, 1), QImage.Format_ARGB32_Premultiplied)
+    atlas.fill(Qt.transparent)
+    painter = QPainter(atlas)
+    index: dict[str, dict[str, dict[str, list[int]]]] = {}
+    for (name, base_size, scale_factor, image), rect in zip(entries, rects):
+        painter.drawImage(rect[0], rect[1], image)
+        index.setdefault(name, {}).setdefault(str(base_size), {})[str(scale_factor)] = list(rect)
+    painter.end()
+
+    if not os.path.isdir(output_path):
+        os.makedirs(output_path)
+    image_path = os.path.join(output_path, 'icons_atlas.png')
+    index_path = os.path.join(output_path, 'icons_atlas.json')
+    atlas.save(image_path, 'PNG')
+    with open(index_path, 'w') as f:
+        json.dump({'version': ATLAS_VERSION, 'icons': index}, f, indent=1, sort_keys=True)
+
+    logger.info(f'Packed {len(entries)} icon images into atlas {atlas.width()}x{atlas.height()}: {image_path}')
+
+    return image_path, index_path
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Builds tp-dcc icons atlas.')
+    parser.add_argument('--output', default=ATLAS_PATH, help='Output folder for the atlas files.')
+    parser.add_argument(
+        '--sizes', type=int, nargs='+', default=list(ATLAS_BASE_SIZES), help='Base icon sizes to rasterize.')
+    parsed_args = parser.parse_args(args)
+
+    # Atlas is built using QImage only, so no windowing system is required.
+    os.environ.setdefault('QT_QPA_PLATFORM', 'offscreen')
+    app = QGuiApplication.instance() or QGuiApplication(sys.argv[:1])
+    build(output_path=parsed_args.output, base_sizes=tuple(parsed_args.sizes))
+    del app
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1 +1,4 @@
+pushd ..\..\..
+"C:\Program Files\Python39\python.exe" -m tp.resources.style.build_atlas
+popd
 "C:\Program Files\Python39\Lib\site-packages\PySide2\rcc.exe" --binary ./icons.qrc -o ./icons.rcc
\ No newline at end of file
@@ -0,0 +1,301 @@
+from __future__ import annotations
+
+import os
+import re
+import hashlib
+import logging
+import tempfile
+from typing import Iterable
+from dataclasses import dataclass
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+STYLE_PATH = os.path.dirname(os.path.abspath(__file__))
+DEFINITIONS_PATH = os.path.join(STYLE_PATH, 'definitions.scss')
+CACHE_PATH = os.path.join(tempfile.gettempdir(), 'tp-dcc', 'style')
+
+# Theme sources, relative to style folder and without extension. Default theme mirrors style.scss imports.
+THEMES: dict[str, tuple[str, ...]] = {
+    'default': ('unreal/unreal', 'tpdcc/tpdcc'),
+    'unreal': ('unreal/unreal',),
+    'tpdcc': ('tpdcc/tpdcc',)
+}
+# Precompiled stylesheets used when qtsass is not available.
+PRECOMPILED_THEMES: dict[str, str] = {
+    'default': 'style.qss',
+    'unreal': 'unreal/unreal.qss',
+    'tpdcc': 'tpdcc/tpdcc.qss'
+}
+
+_DEFINITIONS_IMPORT_REGEX = re.compile(r'@import\s+["\']\.\./definitions["\'];?')
+_COMMENT_REGEX = re.compile(r'/\*.*?\*/', re.DOTALL)
+_RULE_REGEX = re.compile(r'([^{}]+)\{([^{}]*)\}')
+_COMBINATOR_REGEX = re.compile(r'\s*>\s*|\s+')
+_TYPE_SELECTOR_REGEX = re.compile(r'^\.?([A-Za-z_]\w*)')
+_CACHE: dict[str, str] = {}
+_RULES_CACHE: dict[str, tuple[QssRule, ...]] = {}
+_FILTERED_CACHE: dict[tuple[str, frozenset[str]], str] = {}
+_PALETTE_SUBJECTS_CACHE: dict[str, frozenset[str]] = {}
+
+
+@dataclass(frozen=True)
+class QssRule:
+    """
+    A data class that stores a parsed QSS rule.
+
+    Attributes
+    ----------
+    selectors : tuple[str, ...]
+        Selectors of the rule (e.g: ('QPushButton:hover', 'QToolButton:hover')).
+    subjects : tuple[str, ...]
+        For each selector, widget class name its subject can match with. Empty string if selector can match any
+        widget class (e.g: '*', '#centralwidget' or '[flat="true"]').
+    body : str
+        Rule declarations, without braces.
+    """
+
+    selectors: tuple[str, ...]
+    subjects: tuple[str, ...]
+    body: str
+
+    def text(self, selectors: Iterable[str] | None = None) -> str:
+        """
+        Returns QSS text of this rule.
+
+        :param selectors: optional subset of selectors to use. If not given, all rule selectors are used.
+        :return: rule QSS text.
+        """
+
+        selectors = self.selectors if selectors is None else tuple(selectors)
+        return f'{", ".join(selectors)} {{{self.body}}}'
+
+
+def theme_names() -> list[str]:
+    """
+    Returns the names of all available themes.
+
+    :return: theme names.
+    """
+
+    return list(THEMES.keys())
+
+
+def compile_theme(name: str = 'default', variables: dict[str, str] | None = None) -> str:
+    """
+    Returns the QSS of the theme with given name.
+
+    Compilation only happens once per theme and variables: compiled stylesheets are cached in memory and also on
+    disk, so next sessions do not need to compile SCSS sources again.
+
+    :param name: name of the theme to compile.
+    :param variables: optional SCSS variables to override (e.g: {'primary-color': '#ff0000'}). Overrides are only
+        applied if qtsass is available.
+    :return: compiled QSS.
+    """
+
+    if name not in THEMES:
+        logger.warning(f'Theme "{name}" does not exist. Default theme will be used.')
+        name = 'default'
+    variables = variables or {}
+
+    try:
+        # noinspection PyUnresolvedReferences,PyPackageRequirements
+        import qtsass
+    except ImportError:
+        qtsass = None
+
+    if qtsass is None:
+        if variables:
+            logger.debug('qtsass is not available, theme variables will be ignored.')
+        return _precompiled_theme(name)
+
+    sources = [_read(os.path.join(STYLE_PATH, f'{source}.scss')) for source in THEMES[name]]
+    key = _cache_key(name, variables, [_read(DEFINITIONS_PATH)] + sources)
+    cached = _CACHE.get(key)
+    if cached is not None:
+        return cached
+
+    cache_file_path = os.path.join(CACHE_PATH, f'{key}.qss')
+    if os.path.isfile(cache_file_path):
+        _CACHE[key] = _read(cache_file_path)
+        return _CACHE[key]
+
+    overrides = '\n'.join(f'${k.lstrip("$")}: {v};' for k, v in sorted(variables.items()))
+    compiled: list[str] = []
+    for source, contents in zip(THEMES[name], sources):
+        if overrides:
+            if _DEFINITIONS_IMPORT_REGEX.search(contents):
+                contents = _DEFINITIONS_IMPORT_REGEX.sub(lambda match: f'{match.group(0)}\n{overrides}', contents, 1)
+            else:
+                contents = f'{overrides}\n{contents}'
+        source_folder = os.path.dirname(os.path.join(STYLE_PATH, source))
+        compiled.append(qtsass.compile(contents, include_paths=[source_folder, STYLE_PATH]))
+    stylesheet = '\n'.join(compiled)
+    _CACHE[key] = stylesheet
+
+    try:
+        if not os.path.isdir(CACHE_PATH):
+            os.makedirs(CACHE_PATH)
+        with open(cache_file_path, 'w') as f:
+            f.write(stylesheet)
+    except OSError:
+        logger.debug(f'Was not possible to write compiled stylesheet cache file: {cache_file_path}')
+
+    return stylesheet
+
+
+def parse_rules(stylesheet: str) -> tuple[QssRule, ...]:
+    """
+    Parses given QSS into its rules, keeping their order.
+
+    :param stylesheet: QSS to parse.
+    :return: parsed rules.
+    """
+
+    key = hashlib.sha1(stylesheet.encode('utf-8')).hexdigest()
+    rules = _RULES_CACHE.get(key)
+    if rules is not None:
+        return rules
+
+    parsed_rules: list[QssRule] = []
+    for match in _RULE_REGEX.finditer(_COMMENT_REGEX.sub('', stylesheet)):
+        selectors = tuple(selector.strip() for selector in match.group(1).split(',') if selector.strip())
+        if not selectors:
+            continue
+        parsed_rules.append(QssRule(selectors, tuple(_selector_subject(selector) for selector in selectors),
+                                    match.group(2)))
+    rules = _RULES_CACHE[key] = tuple(parsed_rules)
+
+    return rules
+
+
+def filter_stylesheet(stylesheet: str, class_names: Iterable[str]) -> str:
+    """
+    Returns a QSS that only contains the rules of the given stylesheet that can match the given widget classes.
+
+    Rules order is kept, so cascading resolves in the same way than with the full stylesheet.
+
+    :param stylesheet: QSS to filter.
+    :param class_names: names of the widget classes (including their base classes) that should be styled.
+    :return: filtered QSS.
+    """
+
+    class_names = frozenset(class_names)
+    key = (hashlib.sha1(stylesheet.encode('utf-8')).hexdigest(), class_names)
+    filtered = _FILTERED_CACHE.get(key)
+    if filtered is not None:
+        return filtered
+
+    rules: list[str] = []
+    for rule in parse_rules(stylesheet):
+        selectors = [
+            selector for selector, subject in zip(rule.selectors, rule.subjects) if not subject or
+            subject in class_names]
+        if selectors:
+            rules.append(rule.text(selectors))
+    filtered = _FILTERED_CACHE[key] = '\n'.join(rules)
+
+    return filtered
+
+
+def palette_subjects(stylesheet: str) -> frozenset[str]:
+    """
+    Returns the widget classes whose rules within given QSS read colors from the widget palette (e.g:
+    `palette(highlight)`). Those widgets must be repolished when palette colors change.
+
+    :param stylesheet: QSS to inspect.
+    :return: widget class names. Contains an empty string if any rule that can match any widget reads the palette.
+    """
+
+    key = hashlib.sha1(stylesheet.encode('utf-8')).hexdigest()
+    subjects = _PALETTE_SUBJECTS_CACHE.get(key)
+    if subjects is not None:
+        return subjects
+
+    found: set[str] = set()
+    for rule in parse_rules(stylesheet):
+        if 'palette(' in rule.body:
+            found.update(rule.subjects)
+    subjects = _PALETTE_SUBJECTS_CACHE[key] = frozenset(found)
+
+    return subjects
+
+
+def clear_cache():
+    """
+    Clears compiled stylesheets memory cache.
+    """
+
+    _CACHE.clear()
+    _RULES_CACHE.clear()
+    _FILTERED_CACHE.clear()
+    _PALETTE_SUBJECTS_CACHE.clear()
+
+
+def _selector_subject(selector: str) -> str:
+    """
+    Internal function that returns the widget class name the subject of the given selector can match with.
+
+    :param selector: QSS selector (e.g: QComboBox QAbstractItemView::item:selected).
+    :return: widget class name or an empty string if selector subject can match any widget.
+    """
+
+    compound = _COMBINATOR_REGEX.split(selector.strip())[-1]
+    match = _TYPE_SELECTOR_REGEX.match(compound)
+
+    return match.group(1) if match else ''
+
+
+def _precompiled_theme(name: str) -> str:
+    """
+    Internal function that returns the precompiled QSS of the theme with given name.
+
+    :param name: name of the theme.
+    :return: precompiled QSS.
+    """
+
+    key = f'precompiled:{name}'
+    cached = _CACHE.get(key)
+    if cached is None:
+        cached = _read(os.path.join(STYLE_PATH, PRECOMPILED_THEMES[name]))
+        _CACHE[key] = cached
+
+    return cached
+
+
+def _cache_key(name: str, variables: dict[str, str], sources: list[str]) -> str:
+    """
+    Internal function that returns the cache key for the given theme compilation inputs.
+
+    :param name: name of the theme.
+    :param variables: SCSS variables overrides.
+    :param sources: contents of all the SCSS sources involved in the compilation.
+    :return: cache key.
+    """
+
+    sha = hashlib.sha1(name.encode('utf-8'))
+    for k, v in sorted(variables.items()):
+        sha.update(f'{k}={v};'.encode('utf-8'))
+    for source in sources:
+        sha.update(source.encode('utf-8'))
+
+    return sha.hexdigest()
+
+
+def _read(file_path: str) -> str:
+    """
+    Internal function that returns the contents of the given file.
+
+    :param file_path: absolute file path.
+    :return: file contents.
+    """
+
+    with open(file_path, 'r') as f:
+        return f.read()
@@ -0,0 +1,225 @@
+"""
+Profiling tool that measures the polish and paint cost of tp-dcc widget classes under a theme stylesheet and
+attributes that cost to individual QSS rules by removing them one at a time.
+
+Usage (from the repository root folder):
+    python -m tp.resources.style.profile_qss --theme default --output qss_profile.json
+"""
+
+from __future__ import annotations
+
+import os
+import sys
+import json
+import time
+import logging
+import argparse
+import statistics
+from typing import Callable
+
+from . import compiler
+
+logger = logging.getLogger(__name__)
+logger.setLevel(logging.INFO)
+handler = logging.StreamHandler()
+handler.setLevel(logging.INFO)
+# noinspection SpellCheckingInspection
+formatter = logging.Formatter('%(asctime)s - %(name)s - %(levelname)s - %(message)s')
+handler.setFormatter(formatter)
+logger.addHandler(handler)
+
+DEFAULT_COUNT = 50
+DEFAULT_REPEAT = 5
+DEFAULT_CLASSES = ('BaseButton', 'BaseLineEdit', 'ComboBoxRegularWidget')
+
+
+def widget_factories() -> dict[str, Callable]:
+    """
+    Returns the factories of the widget classes that can be profiled.
+
+    :return: dictionary with the widget class names as keys and the functions that create a new widget instance
+        as values.
+    """
+
+    # Widgets are imported here, so this module can be imported before QApplication is created.
+    from ...qt.widgets import buttons, lineedits, comboboxes
+
+    return {
+        'BaseButton': lambda: buttons.BaseButton(text='Button'),
+        'BasePushButton': lambda: buttons.BasePushButton(text='Button'),
+        'BaseToolButton': lambda: buttons.BaseToolButton(),
+        'BaseLineEdit': lambda: lineedits.BaseLineEdit(text='Text', placeholder='Placeholder'),
+        'BaseComboBox': lambda: comboboxes.BaseComboBox(items=['A', 'B', 'C']),
+        'ComboBoxRegularWidget': lambda: comboboxes.ComboBoxRegularWidget(label='Label', items=['A', 'B', 'C'])
+    }
+
+
+def measure(stylesheet: str, factory: Callable, count: int = DEFAULT_COUNT,
+            repeat: int = DEFAULT_REPEAT) -> tuple[float, float]:
+    """
+    Measures the time it takes to polish and to paint the widgets created by the given factory.
+
+    :param stylesheet: QSS to apply.
+    :param factory: function that creates a new widget instance.
+    :param count: number of widget instances to create.
+    :param repeat: number of times the measurement is repeated. Median time is returned.
+    :return: tuple containing polish and paint times per widget instance, in milliseconds.
+    """
+
+    from ...externals.Qt.QtCore import QEvent
+    from ...externals.Qt.QtWidgets import QApplication, QWidget, QVBoxLayout
+
+    polish_times: list[float] = []
+    paint_times: list[float] = []
+    for _ in range(repeat):
+        container = QWidget()
+        layout = QVBoxLayout(container)
+        widgets = [factory() for _ in range(count)]
+        for widget in widgets:
+            layout.addWidget(widget)
+
+        start = time.perf_counter()
+        container.setStyleSheet(stylesheet)
+        container.ensurePolished()
+        for widget in widgets:
+            widget.ensurePolished()
+        polish_times.append((time.perf_counter() - start) * 1000.0 / count)
+
+        start = time.perf_counter()
+        container.grab()
+        paint_times.append((time.perf_counter() - start) * 1000.0 / count)
+
+        # widgets are deleted before next measurement, so they are not polished or painted again.
+        container.deleteLater()
+        QApplication.sendPostedEvents(None, QEvent.DeferredDelete)
+
+    return statistics.median(polish_times), statistics.median(paint_times)
+
+
+def profile(
+        theme_name: str = 'default', class_names: tuple[str, ...] = DEFAULT_CLASSES, count: int = DEFAULT_COUNT,
+        repeat: int = DEFAULT_REPEAT, attribute_rules: bool = True) -> dict:
+    """
+    Profiles the polish and paint cost of the given widget classes under the given theme.
+
+    :param theme_name: name of the theme whose stylesheet will be profiled.
+    :param class_names: names of the widget classes to profile.
+    :param count: number of widget instances created per measurement.
+    :param repeat: number of times each measurement is repeated.
+    :param attribute_rules: whether to attribute cost to individual QSS rules. Each rule that can match the widget
+        class is removed from the stylesheet and the difference with the full stylesheet measurement is reported.
+    :return: profile report.
+    """
+
+    from ...externals.Qt.QtCore import QEvent
+    from ...externals.Qt.QtWidgets import QApplication
+
+    stylesheet = compiler.compile_theme(theme_name)
+    rules = compiler.parse_rules(stylesheet)
+    factories = widget_factories()
+
+    report = {'theme': theme_name, 'count': count, 'repeat': repeat, 'rules': len(rules), 'classes': {}}
+    for class_name in class_names:
+        factory = factories.get(class_name)
+        if factory is None:
+            logger.warning(f'Widget class "{class_name}" cannot be profiled. Available: {list(factories.keys())}')
+            continue
+
+        sample = factory()
+        mro_names = {cls.__name__ for cls in type(sample).__mro__}
+        sample.deleteLater()
+        QApplication.sendPostedEvents(None, QEvent.DeferredDelete)
+
+        class_stylesheet = compiler.filter_stylesheet(stylesheet, mro_names)
+        polish_time, paint_time = measure(stylesheet, factory, count, repeat)
+        split_polish_time, split_paint_time = measure(class_stylesheet, factory, count, repeat)
+        class_report = {
+            'polish_ms': polish_time,
+            'paint_ms': paint_time,
+            'split': {
+                'rules': len(compiler.parse_rules(class_stylesheet)),
+                'polish_ms': split_polish_time,
+                'paint_ms': split_paint_time
+            },
+            'rules': []
+        }
+
+        if attribute_rules:
+            for i, rule in enumerate(rules):
+                if not any(not subject or subject in mro_names for subject in rule.subjects):
+                    continue
+                without_rule = '\n'.join(other.text() for j, other in enumerate(rules) if j != i)
+                rule_polish_time, rule_paint_time = measure(without_rule, factory, count, repeat)
+                class_report['rules'].append({
+                    'selectors': list(rule.selectors),
+                    'polish_ms': polish_time - rule_polish_time,
+                    'paint_ms': paint_time - rule_paint_time
+                })
+            class_report['rules'].sort(key=lambda item: item['polish_ms'] + item['paint_ms'], reverse=True)
+
+        report['classes'][class_name] = class_report
+        QApplication.processEvents()
+
+    return report
+
+
+def format_report(report: dict, top: int = 5) -> str:
+    """
+    Returns a human-readable version of the given profile report.
+
+    :param report: profile report.
+    :param top: number of most expensive rules to show per widget class.
+    :return: formatted report.
+    """
+
+    lines = [f'Theme "{report["theme"]}" ({report["rules"]} rules, {report["count"]} widgets x {report["repeat"]})']
+    for class_name, class_report in report['classes'].items():
+        split_report = class_report['split']
+        lines.append(
+            f'{class_name}: polish {class_report["polish_ms"]:.4f} ms, paint {class_report["paint_ms"]:.4f} ms | '
+            f'split ({split_report["rules"]} rules): polish {split_report["polish_ms"]:.4f} ms, '
+            f'paint {split_report["paint_ms"]:.4f} ms')
+        for rule in class_report['rules'][:top]:
+            lines.append(
+                f'    {", ".join(rule["selectors"])}: polish {rule["polish_ms"]:+.4f} ms, '
+                f'paint {rule["paint_ms"]:+.4f} ms')
+
+    return '\n'.join(lines)
+
+
+def main(args: list[str] | None = None) -> int:
+    """
+    Command line entry point.
+
+    :param args: command line arguments.
+    :return: exit code.
+    """
+
+    parser = argparse.ArgumentParser(description='Profiles tp-dcc theme stylesheet polish and paint cost.')
+    parser.add_argument('--theme', default='default', choices=compiler.theme_names(), help='Theme to profile.')
+    parser.add_argument('--classes', nargs='+', default=list(DEFAULT_CLASSES), help='Widget classes to profile.')
+    parser.add_argument('--count', type=int, default=DEFAULT_COUNT, help='Widgets created per measurement.')
+    parser.add_argument('--repeat', type=int, default=DEFAULT_REPEAT, help='Times each measurement is repeated.')
+    parser.add_argument('--no-rules', action='store_true', help='Skip per rule cost attribution.')
+    parser.add_argument('--output', default='', help='Optional JSON file path to write the report to.')
+    parsed_args = parser.parse_args(args)
+
+    os.environ.setdefault('QT_QPA_PLATFORM', 'offscreen')
+    from ...externals.Qt.QtWidgets import QApplication
+    app = QApplication.instance() or QApplication(sys.argv[:1])
+
+    report = profile(
+        theme_name=parsed_args.theme, class_names=tuple(parsed_args.classes), count=parsed_args.count,
+        repeat=parsed_args.repeat, attribute_rules=not parsed_args.no_rules)
+    print(format_report(report))
+    if parsed_args.output:
+        with open(parsed_args.output, 'w') as f:
+            json.dump(report, f, indent=4)
+        logger.info(f'Profile report written to: {parsed_args.output}')
+    del app
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -2,13 +2,19 @@ from __future__ import annotations
 
 import os
 import enum
+import weakref
+import hashlib
 import logging
+from typing import Iterable
+from dataclasses import dataclass, field
 
-from . import setup, style_file_path
-from ...qt import dpi
+from . import setup, compiler
+from ... import dcc
+from ...qt import dpi, utils as qtutils
 from ...python import helpers
 from ...externals.Qt.QtCore import QResource
-from ...externals.Qt.QtWidgets import QWidget
+from ...externals.Qt.QtWidgets import QApplication, QWidget
+from ...externals.Qt.QtGui import QColor, QPalette
 
 logger = logging.getLogger(__name__)
 logger.setLevel(logging.INFO)
@@ -28,6 +34,27 @@ def instance() -> Theme:
     return Theme.instance()
 
 
+@dataclass
+class ThemeUpdateEvent:
+    """
+    Data class that contains the information of a theme update. Passed to the `update_theme` function of the widgets
+    registered within the theme.
+
+    Attributes
+    ----------
+    theme_dict : helpers.AttributeDict
+        Current theme tokens (e.g: theme_dict.primary_color).
+    changed : set[str]
+        Names of the tokens whose value changed.
+    stylesheet_changed : bool
+        Whether theme stylesheet was applied again.
+    """
+
+    theme_dict: helpers.AttributeDict
+    changed: set[str] = field(default_factory=set)
+    stylesheet_changed: bool = False
+
+
 class Theme:
     """
     Class that defines default theme, which loads a QSS and optionally can modify it on runtime.
@@ -35,6 +62,13 @@ class Theme:
 
     _INSTANCE: Theme | None = None
 
+    # Whether stylesheet is applied once to the whole application instead of to each window. If None, application
+    # scope is only used in standalone mode, so DCC host application UI is never restyled.
+    APPLICATION_SCOPE: bool | None = None
+    STYLESHEET_KEY_PROPERTY = 'tpThemeStylesheetKey'
+    TOKENS_PROPERTY = 'themeTokens'
+    COLOR_TOKENS = ('primary_color', 'info_color', 'success_color', 'warning_color', 'error_color')
+
     # noinspection SpellCheckingInspection
     class Colors:
         """
@@ -90,18 +124,16 @@ class Theme:
     def __init__(self):
         super().__init__()
 
-        self._default_qss: str = ''
+        self._name = 'default'
+        self._variables: dict[str, str] = {}
         self._custom_qss: str = ''
+        self._stylesheet: str | None = None
+        self._stylesheet_key: str = ''
         self._registered_rcc_resources: list[str] = []
-
-        qss_style = style_file_path()
-        if not qss_style:
-            logger.warning(f'TNM QSS file path does not exist: "{qss_style}"')
-            raise RuntimeError('No TNM QSS file found')
+        self._targets: weakref.WeakSet[QWidget] = weakref.WeakSet()
+        self._widgets: weakref.WeakKeyDictionary[QWidget, set[str]] = weakref.WeakKeyDictionary()
 
         setup()
-        with open(qss_style, 'r') as f:
-            self._default_qss = f.read()
 
         scale_factor = dpi.dpi_multiplier()
         self._sizes: helpers.AttributeDict[str, int] = helpers.AttributeDict()
@@ -119,13 +151,8 @@ class Theme:
         self._success_color = Theme.Colors.Luigi
         self._warning_color = Theme.Colors.Beer
         self._error_color = Theme.Colors.RougeSarde
-        self._hyperlink_style = """
-        <style>
-         a {{
-            text-decoration: none;
-            color: {0};
-        }}
-        </style>""".format(self._primary_color)
+        self._hyperlink_style = ''
+        self._update_hyperlink_style()
 
     @classmethod
     def instance(cls) -> Theme:
@@ -138,6 +165,16 @@ class Theme:
 
         return cls._INSTANCE
 
+    @property
+    def name(self) -> str:
+        """
+        Getter method that returns the name of the theme stylesheet sources.
+
+        :return: theme name.
+        """
+
+        return self._name
+
     @property
     def sizes(self) -> helpers.AttributeDict:
         """
@@ -222,6 +259,7 @@ class Theme:
 
         with open(qss_file_path, 'r') as f:
             self._custom_qss += f.read()
+        self._invalidate_stylesheet()
 
         if resources_rcc_file_path:
             self.register_resources_rcc_file_path(resources_rcc_file_path)
@@ -244,15 +282,297 @@ class Theme:
 
         return True
 
+    def set_variables(self, variables: dict[str, str]):
+        """
+        Sets the SCSS variables that will override the ones defined within theme sources.
+
+        :param variables: SCSS variables (e.g: {'primary-color': '#ff0000'}).
+        """
+
+        if variables == self._variables:
+            return
+
+        self._variables = dict(variables)
+        self._invalidate_stylesheet()
+
+    def stylesheet(self) -> str:
+        """
+        Returns the full stylesheet of the theme.
+
+        Stylesheet is compiled only once and cached until theme sources or variables change.
+
+        :return: theme stylesheet.
+        """
+
+        if self._stylesheet is None:
+            stylesheet = compiler.compile_theme(self._name, self._variables)
+            if self._custom_qss:
+                stylesheet += f'\n{self._custom_qss}'
+            self._stylesheet = stylesheet
+            self._stylesheet_key = hashlib.sha1(stylesheet.encode('utf-8')).hexdigest()
+
+        return self._stylesheet
+
+    def stylesheet_key(self) -> str:
+        """
+        Returns a key that identifies current theme stylesheet contents.
+
+        :return: stylesheet key.
+        """
+
+        self.stylesheet()
+        return self._stylesheet_key
+
+    def uses_application_scope(self) -> bool:
+        """
+        Returns whether theme stylesheet is applied to the whole application.
+
+        :return: True if stylesheet is applied to the application; False if it is applied to each window.
+        """
+
+        if QApplication.instance() is None:
+            return False
+        if self.APPLICATION_SCOPE is not None:
+            return self.APPLICATION_SCOPE
+
+        return dcc.is_standalone()
+
     def apply(self, widget: QWidget):
         """
         Applies theme stylesheet to given widget.
 
+        Stylesheet is applied only once: if the application (or the widget, when application scope is not used)
+        already uses current theme stylesheet, this function does nothing, so Qt does not parse the stylesheet again
+        nor repolishes the widgets.
+
         :param QWidget widget: widget to apply stylesheet to.
         """
 
-        stylesheet_to_apply: str = self._default_qss
-        if self._custom_qss:
-            stylesheet_to_apply += f'\n{self._custom_qss}'
+        stylesheet = self.stylesheet()
+        key = self._stylesheet_key
+        target = QApplication.instance() if self.uses_application_scope() else widget
+        if target is not widget and widget.property(self.STYLESHEET_KEY_PROPERTY) is not None:
+            # theme stylesheet was applied to the widget before switching to application scope.
+            widget.setStyleSheet('')
+            self.release(widget)
+        if target.property(self.STYLESHEET_KEY_PROPERTY) == key:
+            return
+
+        if target is widget:
+            self._targets.add(widget)
+        target.setStyleSheet(stylesheet)
+        target.setProperty(self.STYLESHEET_KEY_PROPERTY, key)
+        target.setPalette(self.palette(target.palette()))
+
+    def release(self, widget: QWidget):
+        """
+        Marks given widget as no longer using the theme stylesheet. Must be called before applying a custom stylesheet
+        to a themed widget, so next `apply` call applies theme stylesheet again and theme changes do not override the
+        custom stylesheet.
+
+        :param QWidget widget: widget to release.
+        """
+
+        self._targets.discard(widget)
+        widget.setProperty(self.STYLESHEET_KEY_PROPERTY, None)
+
+    def tokens(self) -> helpers.AttributeDict:
+        """
+        Returns current theme tokens.
+
+        :return: theme tokens (e.g: tokens.primary_color).
+        """
+
+        return helpers.AttributeDict({token: getattr(self, f'_{token}') for token in self.COLOR_TOKENS})
+
+    def palette(self, base_palette: QPalette | None = None) -> QPalette:
+        """
+        Returns a palette with the roles that depend on theme tokens set.
+
+        :param base_palette: optional palette to update roles of.
+        :return: theme palette.
+        """
+
+        palette = QPalette(base_palette) if base_palette is not None else QPalette()
+        primary_color = QColor(self._primary_color)
+        for role in (QPalette.Highlight, QPalette.Link, QPalette.LinkVisited):
+            palette.setColor(role, primary_color)
+
+        return palette
+
+    def register_widget(self, widget: QWidget, tokens: Iterable[str]):
+        """
+        Registers given widget as dependant of the given theme tokens. When any of those tokens change, widget
+        `update_theme` function is called with a `ThemeUpdateEvent` or, if it does not exist, widget is repolished.
+
+        :param widget: widget to register.
+        :param tokens: names of the tokens widget style depends on (e.g: primary_color).
+        """
+
+        tokens = {token for token in tokens if token}
+        if not tokens:
+            return
+
+        widget_tokens = self._widgets.setdefault(widget, set())
+        widget_tokens.update(tokens)
+        widget.setProperty(self.TOKENS_PROPERTY, sorted(widget_tokens))
+
+    def unregister_widget(self, widget: QWidget):
+        """
+        Unregisters given widget, so it is no longer updated when theme tokens change.
+
+        :param widget: widget to unregister.
+        """
+
+        self._widgets.pop(widget, None)
+
+    def set_tokens(self, **tokens: str):
+        """
+        Updates theme tokens values.
+
+        Stylesheet is not applied again: themed QSS rules read token colors from the palette (e.g:
+        `palette(highlight)` for the primary color), so only the palette is updated and only the widgets whose rules
+        read the palette are repolished. Registered widgets that depend on the changed tokens receive a
+        `ThemeUpdateEvent`.
+
+        :param tokens: tokens to update (e.g: primary_color='#ff0000').
+        """
+
+        changed: set[str] = set()
+        for token, value in tokens.items():
+            if token not in self.COLOR_TOKENS:
+                logger.warning(f'Theme token "{token}" does not exist')
+                continue
+            if getattr(self, f'_{token}') == value:
+                continue
+            setattr(self, f'_{token}', value)
+            changed.add(token)
+        if not changed:
+            return
+
+        if 'primary_color' in changed:
+            self._update_hyperlink_style()
+            self._update_palettes()
+            self._repolish_palette_widgets()
+        self._update_widgets(ThemeUpdateEvent(self.tokens(), changed))
+
+    def set_primary_color(self, value: str):
+        """
+        Sets theme primary color.
+
+        :param value: primary color in hexadecimal format (e.g: #ff0000).
+        """
+
+        self.set_tokens(primary_color=value)
+
+    def set_name(self, name: str):
+        """
+        Sets the theme whose stylesheet sources are used (default, tpdcc or unreal).
+
+        Themes differ in their QSS rules, so the new stylesheet is applied again to the application (or to each themed
+        window when application scope is not used), which makes Qt parse it and repolish all the widgets. Use
+        `set_tokens` to change theme colors without applying the stylesheet again.
+
+        :param name: name of the theme.
+        """
+
+        if name == self._name:
+            return
+        if name not in compiler.theme_names():
+            logger.warning(f'Theme "{name}" does not exist. Available themes: {compiler.theme_names()}')
+            return
+
+        self._name = name
+        self._invalidate_stylesheet()
+        targets = [QApplication.instance()] if self.uses_application_scope() else []
+        targets.extend(self._targets)
+        for target in targets:
+            try:
+                self.apply(target)
+            except RuntimeError:
+                # Qt object was already deleted.
+                self._targets.discard(target)
+        self._update_widgets(ThemeUpdateEvent(self.tokens(), stylesheet_changed=True))
+
+    def _update_hyperlink_style(self):
+        """
+        Internal function that updates hyperlink style based on current primary color.
+        """
+
+        self._hyperlink_style = """
+        <style>
+         a {{
+            text-decoration: none;
+            color: {0};
+        }}
+        </style>""".format(self._primary_color)
+
+    def _update_palettes(self):
+        """
+        Internal function that updates the palette of the application or themed windows.
+        """
+
+        if self.uses_application_scope():
+            app = QApplication.instance()
+            app.setPalette(self.palette(app.palette()))
+            return
+
+        for target in list(self._targets):
+            try:
+                target.setPalette(self.palette(target.palette()))
+            except RuntimeError:
+                self._targets.discard(target)
+
+    def _repolish_palette_widgets(self):
+        """
+        Internal function that repolishes the widgets whose stylesheet rules read colors from the palette, so they
+        use the updated palette colors.
+        """
+
+        subjects = compiler.palette_subjects(self.stylesheet())
+        if not subjects:
+            return
+
+        if self.uses_application_scope():
+            widgets = QApplication.allWidgets()
+        else:
+            widgets = []
+            for target in list(self._targets):
+                try:
+                    widgets.append(target)
+                    widgets.extend(target.findChildren(QWidget))
+                except RuntimeError:
+                    self._targets.discard(target)
+        for widget in widgets:
+            try:
+                if '' in subjects or any(cls.__name__ in subjects for cls in type(widget).__mro__):
+                    qtutils.update_widget_style(widget)
+            except RuntimeError:
+                continue
+
+    def _update_widgets(self, event: ThemeUpdateEvent):
+        """
+        Internal function that updates the registered widgets whose style depends on the tokens changed.
+
+        :param event: theme update event.
+        """
+
+        for widget, tokens in list(self._widgets.items()):
+            if not event.stylesheet_changed and not tokens & event.changed:
+                continue
+            try:
+                update_theme = getattr(widget, 'update_theme', None)
+                if update_theme is not None:
+                    update_theme(event)
+                elif not event.stylesheet_changed:
+                    qtutils.update_widget_style(widget)
+            except RuntimeError:
+                self._widgets.pop(widget, None)
+
+    def _invalidate_stylesheet(self):
+        """
+        Internal function that forces the theme stylesheet to be compiled again next time it is requested.
+        """
 
-        widget.setStyleSheet(stylesheet_to_apply)
+        self._stylesheet = None
+        self._stylesheet_key = ''